@@ -0,0 +1,4 @@
+
+int main() { int n = 0;
+
+  std::cout << "dims.cc: " << n << " tests, " << CxxTest::failures << " failures\n"; return CxxTest::failures != 0; }
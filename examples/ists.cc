@@ -128,7 +128,7 @@ int main () {
   /* compute the initial thresholding value. */
   dx = b;
   fwd(dx);
-  double thresh = mu * dx.max().norm();
+  double thresh = mu * hx::max_norm(dx);
 
   // iterate.
   for (std::size_t it = 1; it <= iters; it++) {
@@ -136,14 +136,9 @@ int main () {
     dx = b - x;
     dx *= sched;
     fwd(dx);
-    fx = fx + dx;
-
-    /* apply the l1 function. */
-    auto f = [thresh] (auto& z) {
-      const double znrm = z.norm();
-      z *= (znrm > thresh ? 1 - thresh / znrm : 0);
-    };
-    fx.foreach(f);
+
+    /* update the spectral estimate and apply the l1 function. */
+    fx = hx::soft_threshold(fx + dx, thresh);
 
     /* update the time-domain estimate. */
     x = fx / n;
@@ -0,0 +1,208 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <unistd.h>
+#include <sys/mman.h>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+namespace hx::alloc {
+
+/* hx::alloc::flags
+ *
+ * Enumeration of array allocation options, which may be combined
+ * with operator|():
+ *  @none: page-aligned memory, initialized in parallel.
+ *  @huge: request transparent huge pages.
+ *  @numa_interleave: interleave pages across all online NUMA nodes.
+ *  @uninit: skip element initialization. The memory is still zeroed
+ *   by the kernel, but is only touched by the first later pass.
+ */
+enum flags : int {
+  none = 0,
+  huge = 1 << 0,
+  numa_interleave = 1 << 1,
+  uninit = 1 << 2
+};
+
+/* operator|(): combine allocation flags. */
+inline constexpr flags operator| (flags a, flags b) {
+  return flags(int(a) | int(b));
+}
+
+/* Allocation geometry:
+ *  @alignment: guaranteed alignment of all allocations, in bytes.
+ *  @huge_page: size and alignment of huge-page allocations.
+ */
+inline constexpr std::size_t alignment = 64;
+inline constexpr std::size_t huge_page = std::size_t(1) << 21;
+
+/* hx::alloc::deleter
+ *
+ * Deleter of unique pointers to arrays returned by make_array()
+ * or held by hx::mapped_array, which owns the underlying memory
+ * mapping.
+ */
+struct deleter {
+  /* Mapping:
+   *  @base: start of the mapping.
+   *  @len: number of mapped bytes.
+   */
+  void* base = nullptr;
+  std::size_t len = 0;
+
+  /* operator()(): unmap the memory. */
+  template<typename T>
+  void operator() (T* ptr) const {
+    if (base)
+      ::munmap(base, len);
+  }
+};
+
+/* unique_ptr<T>: owning pointer type returned by make_array(). */
+template<typename T>
+using unique_ptr = std::unique_ptr<T, hx::alloc::deleter>;
+
+/* interleave()
+ *
+ * Set the memory policy of a mapping to interleave its pages over
+ * all online NUMA nodes. Returns false if the policy is unsupported.
+ */
+inline bool interleave (void* ptr, std::size_t len) {
+#if defined(__linux__) && defined(SYS_mbind)
+  std::FILE* fh = std::fopen("/sys/devices/system/node/online", "r");
+  if (!fh)
+    return false;
+
+  /* parse the list of node ranges, e.g. "0-1,4". */
+  unsigned long mask = 0;
+  unsigned int a, b;
+  while (std::fscanf(fh, "%u", &a) == 1) {
+    int c = std::fgetc(fh);
+    b = a;
+    if (c == '-' && std::fscanf(fh, "%u", &b) == 1)
+      c = std::fgetc(fh);
+
+    for (unsigned int n = a; n <= b && n < 8 * sizeof(mask); n++)
+      mask |= 1ul << n;
+
+    if (c != ',')
+      break;
+  }
+
+  std::fclose(fh);
+  if (mask == 0)
+    return false;
+
+  constexpr int mpol_interleave = 3;
+  return ::syscall(SYS_mbind, ptr, len, mpol_interleave, &mask,
+                   8 * sizeof(mask) + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+/* allocate()
+ *
+ * Map @n bytes of zeroed anonymous memory, applying the page size and
+ * placement hints of @f. Returns a deleter owning the mapping, whose
+ * base is null on failure.
+ */
+inline hx::alloc::deleter allocate (std::size_t n, hx::alloc::flags f) {
+  const bool hp = (f & hx::alloc::huge);
+  const std::size_t len = hp ? (n + huge_page - 1) / huge_page * huge_page
+                             : n;
+  const std::size_t span = len + (hp ? huge_page : 0);
+
+  void* ptr = ::mmap(nullptr, span, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED)
+    return {};
+
+  char* start = static_cast<char*>(ptr);
+  if (hp) {
+    /* trim the mapping to a huge-page aligned range. */
+    const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(start);
+    char* aligned = start + (huge_page - addr % huge_page) % huge_page;
+    if (aligned > start)
+      ::munmap(start, aligned - start);
+
+    if (start + span > aligned + len)
+      ::munmap(aligned + len, start + span - (aligned + len));
+
+    start = aligned;
+#if defined(MADV_HUGEPAGE)
+    ::madvise(start, len, MADV_HUGEPAGE);
+#endif
+  }
+
+  if (f & hx::alloc::numa_interleave)
+    hx::alloc::interleave(start, len);
+
+  return {start, len};
+}
+
+/* namespace hx::alloc */ }
+
+namespace hx {
+
+/* make_array<X>()
+ *
+ * Allocate an array of type X, aligned to at least hx::alloc::alignment
+ * bytes, and construct it in place. Unless hx::alloc::uninit is given,
+ * all elements are value initialized under the execution policy @p, so
+ * that parallel passes first-touch the pages they will later work on.
+ * Elements with non-trivial constructors are always initialized by the
+ * constructor of X, after their pages are first-touched. Returns a null
+ * pointer if the memory could not be mapped.
+ */
+template<typename X>
+hx::alloc::unique_ptr<X> make_array (hx::alloc::flags f = hx::alloc::none,
+                                     hx::exec::policy p = hx::exec::par) {
+  using Type = typename X::base_type;
+  static_assert(sizeof(X) == X::size * sizeof(Type));
+  static_assert(std::is_trivially_destructible_v<Type>);
+
+  const hx::alloc::deleter d = hx::alloc::allocate(sizeof(X), f);
+  if (!d.base)
+    return hx::alloc::unique_ptr<X>(nullptr, d);
+
+  constexpr bool trivial = std::is_trivially_default_constructible_v<Type>;
+  const bool init = !(f & hx::alloc::uninit);
+  const std::size_t grain = hx::exec::grain<Type>(1);
+
+  if (init && !trivial) {
+    char* bytes = static_cast<char*>(d.base);
+    hx::exec::for_range(p, sizeof(X), grain * sizeof(Type),
+      [bytes] (std::size_t b0, std::size_t b1) {
+        std::memset(bytes + b0, 0, b1 - b0);
+      });
+  }
+
+  X* arr = ::new (d.base) X;
+  if (init && trivial) {
+    Type* x = arr->raw_data();
+    hx::exec::for_range(p, X::size, grain,
+      [x] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          x[i] = Type();
+      });
+  }
+
+  return hx::alloc::unique_ptr<X>(arr, d);
+}
+
+/* namespace hx */ }
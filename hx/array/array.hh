@@ -5,12 +5,20 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "../op/dot.hh"
 #include "../op/unary.hh"
 #include "../op/binary.hh"
+#include "../op/leaves.hh"
 #include "../op/schedules.hh"
 
+#include "../cursor.hh"
+#include "../exec.hh"
 #include "../index.hh"
+#include "../math.hh"
 #include "../schedule.hh"
 #include "../vector.hh"
 
@@ -40,12 +48,14 @@ public:
    *   inner_type: array data type of the inner sub-array.
    *   type: data type of the current array dimension/layer.
    *   index_type: type of accepted indices to operator[].
+   *   cursor_type: type of offset-carrying indices to operator[].
    */
   using base_type = Type;
   using inner = hx::array<Type, InnerDims...>;
   using inner_type = typename inner::type;
   using type = inner_type[OuterDim];
   using index_type = hx::index<OuterDim, InnerDims...>;
+  using cursor_type = hx::cursor<OuterDim, InnerDims...>;
 
   /* sched_type: type template for all accepted schedules. */
   template<std::size_t N>
@@ -56,6 +66,28 @@ public:
   using insert_type = hx::op::insert<hx::array<Type, N>,
                         hx::schedule<N, OuterDim, InnerDims...>>;
 
+  /* is_operand<T>
+   *
+   * Whether a type is accepted by the compound assignment operators:
+   * either a non-indexable value, or an array or expression that
+   * shares the index type of the array.
+   */
+  template<typename T>
+  static constexpr bool is_operand =
+    !hx::op::is_indexable_v<T> || hx::op::has_index_v<T, index_type>;
+
+  /* project_type<T, dim>
+   *
+   * Type of the array of T's produced by reducing along
+   * the dimension dim.
+   */
+  template<typename T, std::size_t... Ds>
+  static hx::array<T, Ds...> project_array (hx::dims<Ds...>);
+
+  template<typename T, std::size_t dim>
+  using project_type = decltype(project_array<T>(
+    typename hx::dims<OuterDim, InnerDims...>::template exclude<dim>{}));
+
   /* shape<dim>
    *
    * Static member data template holding the array dimension sizes.
@@ -94,12 +126,7 @@ public:
    * Assignment operator from scalar values.
    */
   array& operator= (const Type& val) {
-    index_type idx;
-    do {
-      (*this)[idx] = val;
-    }
-    while (idx++);
-    return *this;
+    return assign(hx::exec::seq, val);
   }
 
   /* operator=(unary)
@@ -108,12 +135,7 @@ public:
    */
   template<hx::op::type type, typename T>
   array& operator= (const hx::op::unary<type, T>& expr) {
-    index_type idx;
-    do {
-      (*this)[idx] = expr[idx];
-    }
-    while (idx++);
-    return *this;
+    return assign(hx::exec::seq, expr);
   }
 
   /* operator=(binary)
@@ -122,12 +144,17 @@ public:
    */
   template<hx::op::type type, typename Ta, typename Tb>
   array& operator= (const hx::op::binary<type, Ta, Tb>& expr) {
-    index_type idx;
-    do {
-      (*this)[idx] = expr[idx];
-    }
-    while (idx++);
-    return *this;
+    return assign(hx::exec::seq, expr);
+  }
+
+  /* assign()
+   *
+   * Assign a scalar value, array or array expression to all array
+   * elements under an execution policy.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& assign (hx::exec::policy p, const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x = y; }, p);
   }
 
   /* operator=(insert)
@@ -142,6 +169,36 @@ public:
     return *this;
   }
 
+  /* operator+=()
+   *
+   * Compound addition operator from scalar values, arrays and array
+   * expressions, evaluated in a single in-place pass. Each element is
+   * read and written exactly once at its own offset, so the operand
+   * may safely reference the array itself.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator+= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator-= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator*= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator/= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x /= y; });
+  }
+
   /* operator*=(schedule)
    *
    * Schedule masking operator, resets all array values whose indices
@@ -149,23 +206,37 @@ public:
    */
   template<std::size_t N>
   array& operator*= (const sched_type<N>& S) {
-    /* make a sorted copy of the schedule. */
-    sched_type<N> sortedS{S};
-    sortedS.sort();
+    return mask(hx::exec::seq, S);
+  }
+
+  /* mask()
+   *
+   * Reset all array values whose indices are not present in a
+   * schedule, under an execution policy.
+   */
+  template<std::size_t N>
+  array& mask (hx::exec::policy p, const sched_type<N>& S) {
+    /* sort the linear offsets of the scheduled indices. */
+    std::vector<std::size_t> keep(N);
+    for (std::size_t i = 0; i < N; i++)
+      keep[i] = S[i].pack_right();
+
+    std::sort(keep.begin(), keep.end());
 
     /* mask the array values. */
-    std::size_t i = 0;
-    index_type idx, mask = sortedS[i];
-    do {
-      if (idx == mask) {
-        i++;
-        mask = (i < N ? sortedS[i] : sortedS[0]);
-      }
-      else {
-        (*this)[idx] = Type{};
-      }
-    }
-    while (idx++);
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &keep] (std::size_t i0, std::size_t i1) {
+        auto k = std::lower_bound(keep.begin(), keep.end(), i0);
+        for (std::size_t i = i0; i < i1; i++) {
+          if (k == keep.end() || *k != i)
+            x[i] = Type{};
+
+          while (k != keep.end() && *k == i)
+            k++;
+        }
+      });
+
     return *this;
   }
 
@@ -192,55 +263,137 @@ public:
     return subscript_const_impl<1>(data[idx[0]], idx);
   }
 
+  /* operator[](cursor_type)
+   *
+   * Subscripting operator with cursor argument. Returns the array
+   * element at the linear offset carried by the cursor.
+   */
+  Type& operator[] (const cursor_type& cur) {
+    return raw_data()[cur.offset()];
+  }
+
+  /* operator[](cursor_type) const */
+  Type operator[] (const cursor_type& cur) const {
+    return raw_data()[cur.offset()];
+  }
+
   /* reduce()
    *
    * Function template for reducing arrays to a single element through
    * a general lambda function.
    */
   template<typename Lambda>
-  Type reduce (const Lambda& f) {
-    index_type idx;
-    Type value = (*this)[idx];
-    idx++;
-
-    do {
-      value = f(value, (*this)[idx]);
-    }
-    while (idx++);
+  Type reduce (const Lambda& f) const {
+    return reduce(hx::exec::seq, f);
+  }
 
-    return value;
+  /* reduce(policy)
+   *
+   * Reduce an array under an execution policy. The order of
+   * evaluation is a fixed tree that depends only on the array size,
+   * so the result is the same for every policy and thread count.
+   */
+  template<typename Lambda>
+  Type reduce (hx::exec::policy p, const Lambda& f) const {
+    const Type* x = raw_data();
+    return hx::exec::reduce(p, size, grain,
+      [x] (std::size_t i) { return x[i]; }, f);
   }
 
   /* min()
    *
    * Return the minimum element of an array.
    */
-  auto min () {
-    return reduce([] (Type& a, Type& b) { return a < b ? a : b; });
+  auto min (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a < b ? a : b;
+    });
   }
 
   /* max()
    *
    * Return the maximum element of an array.
    */
-  auto max () {
-    return reduce([] (Type& a, Type& b) { return a > b ? a : b; });
+  auto max (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a > b ? a : b;
+    });
   }
 
   /* sum()
    *
-   * Return the sum of all elements of an array.
+   * Return the sum of all elements of an array, optionally
+   * using compensated summation.
    */
-  auto sum () {
-    return reduce([] (Type& a, Type& b) { return a + b; });
+  auto sum (hx::exec::policy p = hx::exec::seq,
+            hx::exec::compensation c = hx::exec::none) const {
+    const Type* x = raw_data();
+    return hx::exec::sum(p, c, size, grain,
+      [x] (std::size_t i) { return x[i]; });
   }
 
   /* prod()
    *
    * Return the product of all elements of an array.
    */
-  auto prod () {
-    return reduce([] (Type& a, Type& b) { return a * b; });
+  auto prod (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a * b;
+    });
+  }
+
+  /* reduce<dim>()
+   *
+   * Reduce an array along a single dimension through a general lambda
+   * function, returning a new array over the remaining dimensions.
+   */
+  template<std::size_t dim, typename Lambda,
+           typename = std::enable_if_t<(dim < ndims)>>
+  auto reduce (const Lambda& f) const {
+    return reduce<dim>(hx::exec::seq, f);
+  }
+
+  /* reduce<dim>(policy) */
+  template<std::size_t dim, typename Lambda,
+           typename = std::enable_if_t<(dim < ndims)>>
+  auto reduce (hx::exec::policy p, const Lambda& f) const {
+    const Type* x = raw_data();
+    return project<Type, dim>(p, [x] (std::size_t i) { return x[i]; }, f);
+  }
+
+  /* sum<dim>()
+   *
+   * Return the sums of an array along a single dimension.
+   */
+  template<std::size_t dim, typename = std::enable_if_t<(dim < ndims)>>
+  auto sum (hx::exec::policy p = hx::exec::seq) const {
+    return reduce<dim>(p, [] (const Type& a, const Type& b) {
+      return a + b;
+    });
+  }
+
+  /* max<dim>()
+   *
+   * Return the maxima of an array along a single dimension.
+   */
+  template<std::size_t dim, typename = std::enable_if_t<(dim < ndims)>>
+  auto max (hx::exec::policy p = hx::exec::seq) const {
+    return reduce<dim>(p, [] (const Type& a, const Type& b) {
+      return a > b ? a : b;
+    });
+  }
+
+  /* max_norm<dim>()
+   *
+   * Return the largest element norms of an array along a single
+   * dimension, i.e. its skyline projection.
+   */
+  template<std::size_t dim, typename = std::enable_if_t<(dim < ndims)>>
+  auto max_norm (hx::exec::policy p = hx::exec::seq) const {
+    const Type* x = raw_data();
+    return project<double, dim>(p,
+      [x] (std::size_t i) { return hx::norm(x[i]); },
+      [] (double a, double b) { return a < b ? b : a; });
   }
 
   /* foreach_vector()
@@ -257,13 +410,14 @@ public:
     using skip_type = hx::dim<dim>;
 
     skip_type skip;
-    index_type idx;
+    cursor_type cur;
+    Type* x = raw_data();
 
     do {
-      vector_type v{*this, idx};
+      vector_type v{x + cur.offset()};
       f(v);
     }
-    while (idx += skip);
+    while (cur += skip);
   }
 
   /* foreach_dim()
@@ -286,9 +440,23 @@ public:
    */
   template<typename Lambda>
   void foreach (const Lambda& f) {
-    index_type idx;
-    do { f((*this)[idx]); }
-    while (idx++);
+    foreach(hx::exec::seq, f);
+  }
+
+  /* foreach(policy)
+   *
+   * Execute a function for each element of an array under an
+   * execution policy. Parallel policies may call the function
+   * concurrently on different elements.
+   */
+  template<typename Lambda>
+  void foreach (hx::exec::policy p, const Lambda& f) {
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &f] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          f(x[i]);
+      });
   }
 
   /* raw_data()
@@ -300,12 +468,76 @@ public:
     return &((*this)[idx]);
   }
 
+  /* raw_data() const */
+  const Type* raw_data () const {
+    return const_cast<array*>(this)->raw_data();
+  }
+
 private:
   /* Internal state:
    *  @data: OuterDim-element array of inner_type's.
    */
   type data;
 
+  /* @grain: number of elements of each task under parallel policies. */
+  static constexpr std::size_t grain = hx::exec::grain<Type>(inner_size);
+
+  /* after<dim>()
+   *
+   * Return the number of elements spanned by one step along
+   * the dimension dim.
+   */
+  template<std::size_t dim>
+  static constexpr std::size_t after () {
+    constexpr std::size_t sizes[] = {OuterDim, InnerDims...};
+    std::size_t n = 1;
+    for (std::size_t d = dim + 1; d < ndims; d++)
+      n *= sizes[d];
+
+    return n;
+  }
+
+  /* project<T, dim>()
+   *
+   * Reduce the values get(i) at each linear offset along the dimension
+   * dim. Each output row of contiguous elements is accumulated from
+   * consecutive input rows in one pass, and parallel policies split
+   * the output into tasks.
+   */
+  template<typename T, std::size_t dim, typename Get, typename Op>
+  auto project (hx::exec::policy p, const Get& get, const Op& op) const {
+    constexpr std::size_t n = index_type::template size<dim>();
+    constexpr std::size_t stride = after<dim>();
+    constexpr std::size_t m = size / n;
+    constexpr std::size_t g = hx::exec::grain<Type>(n);
+
+    auto out = std::make_unique<project_type<T, dim>>();
+    T* y = out->raw_data();
+
+    hx::exec::for_range(p, m, g / n, [&] (std::size_t j0, std::size_t j1) {
+      while (j0 < j1) {
+        const std::size_t b = j0 / stride;
+        const std::size_t a0 = j0 % stride;
+        const std::size_t a1 = std::min(stride, a0 + (j1 - j0));
+        const std::size_t base = b * n * stride;
+        T* row = y + b * stride;
+
+        for (std::size_t a = a0; a < a1; a++)
+          row[a] = get(base + a);
+
+        for (std::size_t k = 1; k < n; k++) {
+          const std::size_t in = base + k * stride;
+          for (std::size_t a = a0; a < a1; a++)
+            row[a] = op(row[a], get(in + a));
+        }
+
+        j0 += a1 - a0;
+      }
+    });
+
+    return out;
+  }
+
   /* subscript_impl<i,T>()
    *
    * Implementation of the subscripting operator for index arguments
@@ -328,6 +560,38 @@ private:
     else
       return subscript_const_impl<i + 1>(elem[idx[i]], idx);
   }
+
+  /* update()
+   *
+   * Implementation of the assignment and compound assignment operators.
+   * Values are applied directly, flat operands are evaluated at linear
+   * offsets, and all other operands fall back to multidimensional
+   * indices. Parallel policies split the array into tasks of whole
+   * outermost slabs.
+   */
+  template<typename T, typename Op>
+  array& update (const T& rhs, const Op& op,
+                 hx::exec::policy p = hx::exec::seq) {
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &rhs, &op] (std::size_t i0, std::size_t i1) {
+        if constexpr (!hx::op::is_indexable_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], rhs);
+        }
+        else if constexpr (hx::op::is_flat_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], hx::op::flat(rhs, i));
+        }
+        else {
+          cursor_type cur(i0);
+          for (std::size_t i = i0; i < i1; i++, cur++)
+            op(x[i], rhs[cur]);
+        }
+      });
+
+    return *this;
+  }
 };
 
 /* hx::array<Type, Dim>
@@ -348,6 +612,7 @@ public:
   using base_type = Type;
   using type = Type[Dim];
   using index_type = hx::index<Dim>;
+  using cursor_type = hx::cursor<Dim>;
 
   /* sched_type: type template for all accepted schedules. */
   template<std::size_t N>
@@ -363,6 +628,11 @@ public:
   using insert_type = hx::op::insert<hx::array<Type, N>,
                                      hx::schedule<N, Dim>>;
 
+  /* is_operand<T> */
+  template<typename T>
+  static constexpr bool is_operand =
+    !hx::op::is_indexable_v<T> || hx::op::has_index_v<T, index_type>;
+
   /* shape<0> */
   template<std::size_t idx, typename = std::enable_if_t<idx == 0>>
   static inline constexpr auto shape = index_type::template size<idx>();
@@ -393,10 +663,7 @@ public:
    * Assignment operator from scalar values.
    */
   array& operator= (const Type& val) {
-    for (std::size_t i = 0; i < Dim; i++) {
-      data[i] = val;
-    }
-    return *this;
+    return assign(hx::exec::seq, val);
   }
 
   /* operator=(unary)
@@ -405,12 +672,7 @@ public:
    */
   template<hx::op::type type, typename T>
   array& operator= (const hx::op::unary<type, T>& expr) {
-    index_type idx;
-    do {
-      (*this)[idx] = expr[idx];
-    }
-    while (idx++);
-    return *this;
+    return assign(hx::exec::seq, expr);
   }
 
   /* operator=(binary)
@@ -419,12 +681,13 @@ public:
    */
   template<hx::op::type type, typename Ta, typename Tb>
   array& operator= (const hx::op::binary<type, Ta, Tb>& expr) {
-    index_type idx;
-    do {
-      (*this)[idx] = expr[idx];
-    }
-    while (idx++);
-    return *this;
+    return assign(hx::exec::seq, expr);
+  }
+
+  /* assign() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& assign (hx::exec::policy p, const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x = y; }, p);
   }
 
   /* operator=(extract)
@@ -448,26 +711,60 @@ public:
     return *this;
   }
 
+  /* operator+=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator+= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator-= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator*= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  array& operator/= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x /= y; });
+  }
+
   /* operator*=(schedule) */
   template<std::size_t N>
   array& operator*= (const sched_type<N>& S) {
-    /* make a sorted copy of the schedule. */
-    sched_type<N> sortedS{S};
-    sortedS.sort();
+    return mask(hx::exec::seq, S);
+  }
+
+  /* mask() */
+  template<std::size_t N>
+  array& mask (hx::exec::policy p, const sched_type<N>& S) {
+    /* sort the linear offsets of the scheduled indices. */
+    std::vector<std::size_t> keep(N);
+    for (std::size_t i = 0; i < N; i++)
+      keep[i] = S[i].pack_right();
+
+    std::sort(keep.begin(), keep.end());
 
     /* mask the array values. */
-    std::size_t i = 0;
-    index_type idx, mask = sortedS[i];
-    do {
-      if (idx == mask) {
-        i++;
-        mask = (i < N ? sortedS[i] : sortedS[0]);
-      }
-      else {
-        (*this)[idx] = Type{};
-      }
-    }
-    while (idx++);
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &keep] (std::size_t i0, std::size_t i1) {
+        auto k = std::lower_bound(keep.begin(), keep.end(), i0);
+        for (std::size_t i = i0; i < i1; i++) {
+          if (k == keep.end() || *k != i)
+            x[i] = Type{};
+
+          while (k != keep.end() && *k == i)
+            k++;
+        }
+      });
+
     return *this;
   }
 
@@ -486,38 +783,60 @@ public:
     return data[idx[0]];
   }
 
+  /* operator[](cursor_type) */
+  Type& operator[] (const cursor_type& cur) {
+    return data[cur.offset()];
+  }
+
+  /* operator[](cursor_type) const */
+  Type operator[] (const cursor_type& cur) const {
+    return data[cur.offset()];
+  }
+
   /* reduce()
    *
    * Implementation of reduce() for one-dimensional arrays.
    */
   template<typename Lambda>
-  Type reduce (const Lambda& f) {
-    Type value = data[0];
-
-    for (std::size_t i = 1; i < Dim; i++)
-      value = f(value, data[i]);
+  Type reduce (const Lambda& f) const {
+    return reduce(hx::exec::seq, f);
+  }
 
-    return value;
+  /* reduce(policy) */
+  template<typename Lambda>
+  Type reduce (hx::exec::policy p, const Lambda& f) const {
+    const Type* x = raw_data();
+    return hx::exec::reduce(p, size, grain,
+      [x] (std::size_t i) { return x[i]; }, f);
   }
 
   /* min() */
-  auto min () {
-    return reduce([] (Type& a, Type& b) { return a < b ? a : b; });
+  auto min (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a < b ? a : b;
+    });
   }
 
   /* max() */
-  auto max () {
-    return reduce([] (Type& a, Type& b) { return a > b ? a : b; });
+  auto max (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a > b ? a : b;
+    });
   }
 
   /* sum() */
-  auto sum () {
-    return reduce([] (Type& a, Type& b) { return a + b; });
+  auto sum (hx::exec::policy p = hx::exec::seq,
+            hx::exec::compensation c = hx::exec::none) const {
+    const Type* x = raw_data();
+    return hx::exec::sum(p, c, size, grain,
+      [x] (std::size_t i) { return x[i]; });
   }
 
   /* prod() */
-  auto prod () {
-    return reduce([] (Type& a, Type& b) { return a * b; });
+  auto prod (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a * b;
+    });
   }
 
   /* foreach_vector()
@@ -547,8 +866,18 @@ public:
    */
   template<typename Lambda>
   void foreach (const Lambda& f) {
-    for (std::size_t i = 0; i < Dim; i++)
-      f(data[i]);
+    foreach(hx::exec::seq, f);
+  }
+
+  /* foreach(policy) */
+  template<typename Lambda>
+  void foreach (hx::exec::policy p, const Lambda& f) {
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &f] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          f(x[i]);
+      });
   }
 
   /* raw_data()
@@ -559,11 +888,44 @@ public:
     return &(data[0]);
   }
 
+  /* raw_data() const */
+  const Type* raw_data () const {
+    return &(data[0]);
+  }
+
 private:
   /* Internal state:
    *  @data: Dim-element array of Type's.
    */
   type data;
+
+  /* @grain: number of elements of each task under parallel policies. */
+  static constexpr std::size_t grain = hx::exec::grain<Type>(1);
+
+  /* update() */
+  template<typename T, typename Op>
+  array& update (const T& rhs, const Op& op,
+                 hx::exec::policy p = hx::exec::seq) {
+    Type* x = raw_data();
+    hx::exec::for_range(p, size, grain,
+      [x, &rhs, &op] (std::size_t i0, std::size_t i1) {
+        if constexpr (!hx::op::is_indexable_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], rhs);
+        }
+        else if constexpr (hx::op::is_flat_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], hx::op::flat(rhs, i));
+        }
+        else {
+          cursor_type cur(i0);
+          for (std::size_t i = i0; i < i1; i++, cur++)
+            op(x[i], rhs[cur]);
+        }
+      });
+
+    return *this;
+  }
 };
 
 /* namespace hx */ }
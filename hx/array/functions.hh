@@ -0,0 +1,91 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+#include "utility.hh"
+
+namespace hx {
+
+/* is_expression<T>
+ *
+ * Struct template for checking if a type is an array expression.
+ */
+template<typename T>
+struct is_expression : public std::false_type {};
+
+/* is_expression<unary<type, T>> */
+template<hx::op::type type, typename T>
+struct is_expression<hx::op::unary<type, T>> : public std::true_type {};
+
+/* is_expression<binary<type, Ta, Tb>> */
+template<hx::op::type type, typename Ta, typename Tb, bool A, bool B>
+struct is_expression<hx::op::binary<type, Ta, Tb, A, B>>
+ : public std::true_type {};
+
+/* is_expression_v<T>
+ *
+ * Constant expression returning the value of is_expression<T>.
+ */
+template<typename T>
+inline constexpr bool is_expression_v = hx::is_expression<T>::value;
+
+/* is_lazy_operand_v<T>, lazy_operand<T>
+ *
+ * Whether a type may be the operand of a lazy element-wise function,
+ * and the type used to hold it: arrays are held by reference, and
+ * expressions by value.
+ */
+template<typename T>
+inline constexpr bool is_lazy_operand_v =
+  hx::is_array_v<T> || hx::is_expression_v<T>;
+
+template<typename T>
+using lazy_operand = std::conditional_t<hx::is_array_v<T>, const T&, T>;
+
+/* norm(array) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto norm (const T& x) {
+  return hx::op::unary<hx::op::norm, hx::lazy_operand<T>>(x);
+}
+
+/* squaredNorm(array) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto squaredNorm (const T& x) {
+  return hx::op::unary<hx::op::squared_norm, hx::lazy_operand<T>>(x);
+}
+
+/* abs(array) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto abs (const T& x) {
+  return hx::op::unary<hx::op::abs, hx::lazy_operand<T>>(x);
+}
+
+/* exp(array) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto exp (const T& x) {
+  return hx::op::unary<hx::op::exp, hx::lazy_operand<T>>(x);
+}
+
+/* sqrt(array) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto sqrt (const T& x) {
+  return hx::op::unary<hx::op::sqrt, hx::lazy_operand<T>>(x);
+}
+
+/* conj(array, unit) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto conj (const T& x, std::size_t u) {
+  return hx::op::binary<hx::op::conjugate, hx::lazy_operand<T>,
+                        std::size_t>(x, u);
+}
+
+/* soft_threshold(array, value) */
+template<typename T, typename = std::enable_if_t<is_lazy_operand_v<T>>>
+auto soft_threshold (const T& x, double t) {
+  return hx::op::binary<hx::op::threshold, hx::lazy_operand<T>,
+                        double>(x, t);
+}
+
+/* namespace hx */ }
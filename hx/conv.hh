@@ -0,0 +1,299 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <vector>
+
+namespace hx::fir {
+
+/* hx::fir::method
+ *
+ * Enumeration of the available finite impulse response
+ * filtering methods.
+ */
+enum method : int { automatic, direct, overlap_add, overlap_save };
+
+/* hx::fir::filter<Type,N,K,Dim,Method,Lag>
+ *
+ * Finite impulse response filter with a K-point kernel g, which
+ * computes the N-point result:
+ *
+ *   y[n] = sum_{k < K} g[k] * x[n + Lag - k],  n = 0, 1, ..., N-1
+ *
+ * in-place on vectors of Type's, where x is zero outside [0, N).
+ * Long kernels are applied by fast transforms along the multicomplex
+ * unit Dim, using the cached spectrum of the kernel, and short kernels
+ * are applied directly.
+ */
+template<typename Type, std::size_t N, std::size_t K, std::size_t Dim,
+         hx::fir::method Method, std::size_t Lag>
+class filter {
+  static_assert(K > 0 && (Lag == 0 || Lag + 1 == K));
+
+public:
+  /* operator()()
+   *
+   * Apply the filter in-place to the provided data vector.
+   */
+  template<typename Ptr>
+  void operator() (Ptr x) const {
+    if constexpr (mode == hx::fir::direct)
+      apply_direct(x);
+    else if constexpr (mode == hx::fir::overlap_add)
+      apply_ola(x);
+    else
+      apply_ols(x);
+  }
+
+private:
+  /* lg()
+   *
+   * Return the ceiling of the base-2 logarithm of n.
+   */
+  static constexpr std::size_t lg (std::size_t n) {
+    std::size_t l = 0;
+    while ((std::size_t(1) << l) < n) l++;
+    return l;
+  }
+
+  /* fft_cost()
+   *
+   * Estimated cost of filtering a vector by transforms of length m.
+   */
+  static constexpr std::size_t fft_cost (std::size_t m) {
+    const std::size_t b = m - K + 1;
+    return ((N + b - 1) / b) * (2 * m * lg(m) + m);
+  }
+
+  /* best_size()
+   *
+   * Return the supported transform length that minimizes fft_cost().
+   */
+  static constexpr std::size_t best_size () {
+    const std::size_t last = hx::fft::good_size(N + K - 1);
+    std::size_t best = last;
+
+    for (std::size_t m = hx::fft::good_size(K + 1); m < last;
+         m = hx::fft::good_size(m + 1))
+      if (fft_cost(m) < fft_cost(best))
+        best = m;
+
+    return best;
+  }
+
+  /* choose()
+   *
+   * Return the method used for filtering, selecting the direct method
+   * for short kernels when the method is automatic.
+   */
+  static constexpr hx::fir::method choose () {
+    if constexpr (Method != hx::fir::automatic)
+      return Method;
+    else if (N * K <= fft_cost(best_size()))
+      return hx::fir::direct;
+    else
+      return hx::fir::overlap_save;
+  }
+
+public:
+  /* Filtering plan:
+   *  @mode: method selected for filtering.
+   *  @M: length of the transforms, for fft-based methods.
+   *  @B: number of points computed from each transform.
+   */
+  static constexpr hx::fir::method mode = choose();
+  static constexpr std::size_t M = best_size();
+  static constexpr std::size_t B = M - K + 1;
+
+protected:
+  /* filter()
+   *
+   * Default constructor. Derived classes are expected to store the
+   * kernel values into @g and then call prepare().
+   */
+  filter () : g(K) {}
+
+  /* prepare()
+   *
+   * Compute and cache the kernel spectrum, pre-scaled by 1/M to
+   * normalize the unscaled inverse transforms.
+   */
+  void prepare () {
+    if constexpr (mode != hx::fir::direct) {
+      H.assign(M, Type{});
+      for (std::size_t k = 0; k < K; k++)
+        H[k] = g[k];
+
+      const hx::fft::forward<Type, M, Dim> f;
+      f(H.data());
+
+      for (std::size_t m = 0; m < M; m++)
+        H[m] = H[m] / double(M);
+    }
+  }
+
+  /* Kernel data:
+   *  @g: kernel values, in the order they are applied.
+   *  @H: scaled spectrum of the kernel.
+   */
+  std::vector<Type> g, H;
+
+private:
+  /* convolve()
+   *
+   * Apply the kernel spectrum to a zero-padded block of data.
+   */
+  void convolve (std::vector<Type>& buf) const {
+    const hx::fft::forward<Type, M, Dim> f;
+    const hx::fft::inverse<Type, M, Dim> fi;
+
+    f(buf.data());
+    for (std::size_t m = 0; m < M; m++)
+      buf[m] = buf[m] * H[m];
+
+    fi(buf.data());
+  }
+
+  /* apply_direct()
+   *
+   * Direct-form filter. Outputs are computed in the order that only
+   * overwrites input values that are no longer needed.
+   */
+  template<typename Ptr>
+  void apply_direct (Ptr x) const {
+    for (std::size_t i = 0; i < N; i++) {
+      const std::size_t n = (Lag == 0 ? N - 1 - i : i);
+      Type acc{};
+
+      for (std::size_t k = 0; k < K; k++) {
+        if (n + Lag < k || n + Lag - k >= N)
+          continue;
+
+        acc += g[k] * x[n + Lag - k];
+      }
+
+      x[n] = acc;
+    }
+  }
+
+  /* apply_ols()
+   *
+   * Overlap-save filter. Each block of B outputs is computed from
+   * a block of M inputs, discarding the circularly aliased points.
+   */
+  template<typename Ptr>
+  void apply_ols (Ptr x) const {
+    constexpr std::size_t nblk = (N + B - 1) / B;
+    std::vector<Type> buf(M);
+
+    for (std::size_t b = 0; b < nblk; b++) {
+      const std::size_t n0 = (Lag == 0 ? nblk - 1 - b : b) * B;
+
+      /* load the inputs that contribute to the block. */
+      for (std::size_t m = 0; m < M; m++) {
+        const std::size_t i = n0 + Lag + m;
+        buf[m] = (i >= K - 1 && i - (K - 1) < N ? Type(x[i - (K - 1)])
+                                                : Type{});
+      }
+
+      convolve(buf);
+
+      /* store the outputs of the block. */
+      for (std::size_t j = 0; j < B && n0 + j < N; j++)
+        x[n0 + j] = buf[K - 1 + j];
+    }
+  }
+
+  /* apply_ola()
+   *
+   * Overlap-add filter. Each block of B inputs is filtered into M
+   * outputs, which overwrite the inputs of the block and accumulate
+   * into the outputs of neighbouring blocks.
+   */
+  template<typename Ptr>
+  void apply_ola (Ptr x) const {
+    constexpr std::size_t nblk = (N + B - 1) / B;
+    std::vector<Type> buf(M);
+
+    for (std::size_t b = 0; b < nblk; b++) {
+      const std::size_t i0 = (Lag == 0 ? nblk - 1 - b : b) * B;
+
+      /* load the inputs of the block. */
+      for (std::size_t m = 0; m < M; m++)
+        buf[m] = (m < B && i0 + m < N ? Type(x[i0 + m]) : Type{});
+
+      convolve(buf);
+
+      /* store or accumulate the outputs of the block. */
+      for (std::size_t p = 0; p < M; p++) {
+        if (i0 + p < Lag || i0 + p - Lag >= N)
+          continue;
+
+        const std::size_t n = i0 + p - Lag;
+        if (n >= i0 && n < i0 + B)
+          x[n] = buf[p];
+        else
+          x[n] += buf[p];
+      }
+    }
+  }
+};
+
+/* namespace hx::fir */ }
+
+namespace hx {
+
+/* hx::conv<Type,N,K,Dim,Method>
+ *
+ * Convolution of N-point vectors with a K-point kernel h:
+ *
+ *   y[n] = sum_{k < K} h[k] * x[n - k]
+ *
+ * Applied to arrays along dimension d by foreach_vector<d>(),
+ * with Dim = d + 1.
+ */
+template<typename Type, std::size_t N, std::size_t K, std::size_t Dim = 1,
+         hx::fir::method Method = hx::fir::automatic>
+class conv : public hx::fir::filter<Type, N, K, Dim, Method, 0> {
+public:
+  /* conv(array)
+   *
+   * Constructor taking the convolution kernel.
+   */
+  conv (const hx::array<Type, K>& h) {
+    for (std::size_t k = 0; k < K; k++)
+      this->g[k] = h[k];
+
+    this->prepare();
+  }
+};
+
+/* hx::xcorr<Type,N,K,Dim,Method>
+ *
+ * Cross-correlation of N-point vectors with a K-point kernel h:
+ *
+ *   y[n] = sum_{k < K} x[n + k] * ~h[k]
+ *
+ * Applied to arrays along dimension d by foreach_vector<d>(),
+ * with Dim = d + 1.
+ */
+template<typename Type, std::size_t N, std::size_t K, std::size_t Dim = 1,
+         hx::fir::method Method = hx::fir::automatic>
+class xcorr : public hx::fir::filter<Type, N, K, Dim, Method, K - 1> {
+public:
+  /* xcorr(array)
+   *
+   * Constructor taking the correlation kernel.
+   */
+  xcorr (const hx::array<Type, K>& h) {
+    for (std::size_t k = 0; k < K; k++)
+      this->g[k] = ~h[K - 1 - k];
+
+    this->prepare();
+  }
+};
+
+/* namespace hx */ }
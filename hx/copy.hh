@@ -0,0 +1,218 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace hx {
+
+/* cache_bytes()
+ *
+ * Return the size of the last-level cache, or hx::exec::llc_bytes
+ * if it cannot be determined. Copies larger than this bypass the
+ * cache.
+ */
+inline std::size_t cache_bytes () {
+  static const std::size_t n = [] {
+    long v = -1;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+    v = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+    return v > 0 ? std::size_t(v) : hx::exec::llc_bytes;
+  }();
+
+  return n;
+}
+
+/* stream_copy()
+ *
+ * Copy @n bytes between non-overlapping buffers using non-temporal
+ * stores, which write around the cache instead of evicting its
+ * contents. Falls back to std::memcpy() when unsupported.
+ */
+inline void stream_copy (void* dst, const void* src, std::size_t n) {
+#if defined(__SSE2__)
+  char* d = static_cast<char*>(dst);
+  const char* s = static_cast<const char*>(src);
+
+  /* copy up to the first 16-byte aligned destination address. */
+  const std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(d);
+  const std::size_t head = std::min<std::size_t>(n, (16 - addr % 16) % 16);
+  std::memcpy(d, s, head);
+  d += head;
+  s += head;
+  n -= head;
+
+  /* stream whole 64-byte lines. */
+  for (; n >= 64; d += 64, s += 64, n -= 64) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s));
+    const __m128i b = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(s + 16));
+    const __m128i c = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(s + 32));
+    const __m128i e = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(s + 48));
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d), a);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + 16), b);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + 32), c);
+    _mm_stream_si128(reinterpret_cast<__m128i*>(d + 48), e);
+  }
+
+  std::memcpy(d, s, n);
+  _mm_sfence();
+#else
+  std::memcpy(dst, src, n);
+#endif
+}
+
+/* copy()
+ *
+ * Copy all elements of an array into another of identical layout as
+ * a single block of bytes, split into tasks under the execution policy
+ * @p. Arrays larger than the last-level cache are copied using
+ * non-temporal stores.
+ */
+template<typename X>
+void copy (X& dst, const X& src, hx::exec::policy p = hx::exec::seq) {
+  using Type = typename X::base_type;
+  static_assert(std::is_trivially_copyable_v<Type>);
+
+  constexpr std::size_t bytes = X::size * sizeof(Type);
+  const bool stream = (bytes > hx::cache_bytes());
+
+  char* d = reinterpret_cast<char*>(dst.raw_data());
+  const char* s = reinterpret_cast<const char*>(src.raw_data());
+  hx::exec::for_range(p, bytes, hx::exec::task_bytes,
+    [d, s, stream] (std::size_t b0, std::size_t b1) {
+      if (stream)
+        hx::stream_copy(d + b0, s + b0, b1 - b0);
+      else
+        std::memcpy(d + b0, s + b0, b1 - b0);
+    });
+}
+
+/* extents()
+ *
+ * Return the size of each dimension of an hx::array, hx::dynarray
+ * or hx::view.
+ */
+template<typename X, std::size_t... Is>
+std::array<std::size_t, X::ndims> extents (const X& x,
+                                           std::index_sequence<Is...>) {
+  if constexpr (hx::op::has_index_v<X, std::array<std::size_t, X::ndims>>)
+    return {{ x.shape(Is)... }};
+  else
+    return {{ X::template shape<Is>... }};
+}
+
+/* extents(X) */
+template<typename X>
+std::array<std::size_t, X::ndims> extents (const X& x) {
+  return hx::extents(x, std::make_index_sequence<X::ndims>());
+}
+
+/* copy_box()
+ *
+ * Copy the box of @extent elements starting at index @src_lo of a
+ * contiguous row-major array into the box starting at index @dst_lo
+ * of another such array of equal rank. Both boxes must lie within
+ * their arrays, and may be empty. Each row of the box along the innermost dimension is moved
+ * by a single std::memcpy(), and tasks of whole rows are split over
+ * the execution policy @p.
+ *
+ * When @fill is true, all elements of @dst outside the box are also
+ * set to zero bytes, touching each destination row exactly once.
+ */
+template<typename Xs, typename Xd, std::size_t N = Xd::ndims>
+void copy_box (const Xs& src, const std::array<std::size_t, N>& src_lo,
+               Xd& dst, const std::array<std::size_t, N>& dst_lo,
+               const std::array<std::size_t, N>& extent,
+               bool fill = false, hx::exec::policy p = hx::exec::seq) {
+  using Type = typename Xd::base_type;
+  static_assert(Xs::ndims == N);
+  static_assert(std::is_same_v<typename Xs::base_type, Type>);
+  static_assert(std::is_trivially_copyable_v<Type>);
+  static_assert(hx::op::is_flat_v<Xs> && hx::op::is_flat_v<Xd>);
+
+  const auto ss = hx::extents(src);
+  const auto ds = hx::extents(dst);
+  const Type* x = src.raw_data();
+  Type* y = dst.raw_data();
+
+  /* row-major strides of both arrays. */
+  std::array<std::size_t, N> sst, dst_st;
+  sst[N - 1] = dst_st[N - 1] = 1;
+  for (std::size_t d = N - 1; d > 0; d--) {
+    sst[d - 1] = sst[d] * ss[d];
+    dst_st[d - 1] = dst_st[d] * ds[d];
+  }
+
+  /* rows visited: all destination rows when filling, otherwise
+   * only the rows of the box.
+   */
+  const auto& rext = (fill ? ds : extent);
+  std::size_t rows = 1;
+  for (std::size_t d = 0; d + 1 < N; d++)
+    rows *= rext[d];
+
+  const std::size_t inner = rext[N - 1];
+  if (rows == 0 || inner == 0)
+    return;
+
+  const std::size_t run = extent[N - 1] * sizeof(Type);
+  const std::size_t per =
+    std::max<std::size_t>(1, hx::exec::task_bytes / (inner * sizeof(Type)));
+
+  hx::exec::for_range(p, rows, per, [&] (std::size_t r0, std::size_t r1) {
+    for (std::size_t r = r0; r < r1; r++) {
+      /* locate the row in both arrays. */
+      bool inside = true;
+      std::size_t so = src_lo[N - 1], doff = 0, rem = r;
+      for (std::size_t d = N - 1; d > 0; d--) {
+        const std::size_t i = rem % rext[d - 1];
+        rem /= rext[d - 1];
+
+        const std::size_t di = (fill ? i : dst_lo[d - 1] + i);
+        doff += di * dst_st[d - 1];
+
+        const bool in_box = di >= dst_lo[d - 1] &&
+                            di < dst_lo[d - 1] + extent[d - 1];
+        inside = inside && in_box;
+        if (in_box)
+          so += (di - dst_lo[d - 1] + src_lo[d - 1]) * sst[d - 1];
+      }
+
+      Type* row = y + doff;
+      if (!fill) {
+        std::memcpy(row + dst_lo[N - 1], x + so, run);
+      }
+      else if (!inside) {
+        std::memset(static_cast<void*>(row), 0, ds[N - 1] * sizeof(Type));
+      }
+      else {
+        const std::size_t lo = dst_lo[N - 1];
+        const std::size_t hi = lo + extent[N - 1];
+        std::memset(static_cast<void*>(row), 0, lo * sizeof(Type));
+        std::memcpy(row + lo, x + so, run);
+        std::memset(static_cast<void*>(row + hi), 0,
+                    (ds[N - 1] - hi) * sizeof(Type));
+      }
+    }
+  });
+}
+
+/* namespace hx */ }
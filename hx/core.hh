@@ -6,22 +6,45 @@
 #pragma once
 
 #include "scalar.hh"
+#include "scalarf.hh"
+#include "math.hh"
 #include "schedule.hh"
 
 #include "array/array.hh"
 #include "array/utility.hh"
 
 #include "array/overloads.hh"
+#include "array/functions.hh"
+#include "reduce.hh"
+#include "dynarray.hh"
+#include "view.hh"
+#include "alloc.hh"
+#include "mapped.hh"
+#include "copy.hh"
+#include "planar.hh"
+#include "tiled.hh"
 #include "op/overloads.hh"
 #include "dot.hh"
 
 #include "vector.hh"
 #include "matrix.hh"
+#include "transpose.hh"
 
 #include "fft/direction.hh"
+#include "fft/strategy.hh"
+#include "fft/widen.hh"
 #include "fft/shuffle.hh"
+#include "fft/plan.hh"
 #include "fft/blocks.hh"
 #include "fft/transform.hh"
+#include "fft/dynamic.hh"
+#include "fft/multi.hh"
+#include "fft/stft.hh"
+#include "fft/sparse.hh"
+#include "fft/hilbert.hh"
+#include "fft/outofcore.hh"
+
+#include "conv.hh"
 
 #include "proc/node.hh"
 
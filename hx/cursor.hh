@@ -0,0 +1,130 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+
+#include "index.hh"
+
+namespace hx {
+
+/* hx::cursor<Sizes...>
+ *
+ * Multidimensional index that carries the right-first linear array
+ * offset alongside its coordinates. Both are updated incrementally
+ * using precomputed strides, so that stepping a cursor costs one
+ * addition plus a rare carry, and hx::array's may be subscripted
+ * by a cursor without recomputing the element address.
+ */
+template<std::size_t... Sizes>
+class cursor {
+public:
+  /* index_type: type of the coordinates of the cursor. */
+  using index_type = hx::index<Sizes...>;
+
+  /* cursor()
+   *
+   * Default constructor.
+   */
+  constexpr cursor () : idx(), off(0) {}
+
+  /* cursor(size_t)
+   *
+   * Constructor from a right-first linear array offset.
+   */
+  explicit constexpr cursor (std::size_t offset) : idx(), off(offset) {
+    idx.unpack_right(offset);
+  }
+
+  /* operator[]()
+   *
+   * Subscripting operator. Returns a single coordinate of the cursor.
+   */
+  constexpr std::size_t operator[] (std::size_t i) const {
+    return idx[i];
+  }
+
+  /* index(): coordinates of the cursor. */
+  constexpr const index_type& index () const { return idx; }
+
+  /* operator index_type(): coordinates of the cursor. */
+  constexpr operator const index_type& () const { return idx; }
+
+  /* offset(): right-first linear array offset of the cursor. */
+  constexpr std::size_t offset () const { return off; }
+
+  /* operator++(int)
+   *
+   * Post-increment operator, (cur++). Returns false after rolling
+   * over from the last element to the first.
+   */
+  constexpr bool operator++ (int) {
+    off++;
+    for (std::size_t i = n; i > 0; i--) {
+      if (++idx[i - 1] < sz[i - 1])
+        return true;
+
+      idx[i - 1] = 0;
+    }
+
+    off = 0;
+    return false;
+  }
+
+  /* operator+=(cursor&,dim)
+   *
+   * Skipped-dimension post-increment operator, (cur++ [[skip: Dim]]).
+   */
+  template<std::size_t Dim>
+  constexpr friend bool operator+= (cursor& C, const hx::dim<Dim>& skip) {
+    for (std::size_t i = n; i > 0; i--) {
+      if (i == Dim + 1)
+        continue;
+
+      C.off += st[i - 1];
+      if (++C.idx[i - 1] < sz[i - 1])
+        return true;
+
+      C.off -= sz[i - 1] * st[i - 1];
+      C.idx[i - 1] = 0;
+    }
+
+    return false;
+  }
+
+  /* stride()
+   *
+   * Return the linear array stride for stepping along dimension @i.
+   */
+  static constexpr std::size_t stride (std::size_t i) {
+    return st[i];
+  }
+
+private:
+  /* Static properties:
+   *  @n: number of dimensions spanned by the cursor.
+   *  @sz: extent values of the multidimensional cursor.
+   *  @st: linear array strides of each dimension.
+   */
+  static constexpr std::size_t n = sizeof...(Sizes);
+  static constexpr std::size_t sz[n] = {Sizes...};
+  static constexpr std::array<std::size_t, n> st = [] {
+    std::array<std::size_t, n> s{};
+    for (std::size_t i = n, p = 1; i > 0; p *= sz[i - 1], i--)
+      s[i - 1] = p;
+
+    return s;
+  }();
+
+  /* Internal state:
+   *  @idx: coordinates of the cursor.
+   *  @off: linear array offset of the cursor.
+   */
+  index_type idx;
+  std::size_t off;
+};
+
+/* namespace hx */ }
@@ -0,0 +1,368 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "exec.hh"
+#include "array/utility.hh"
+
+namespace hx {
+
+/* hx::dynarray<Type, Rank>
+ *
+ * Multidimensional array class with sizes chosen at run time and
+ * heap-allocated, row-major storage. Shares the element-wise
+ * expressions, policies and reductions of hx::array.
+ */
+template<typename Type, std::size_t Rank>
+class dynarray {
+  static_assert(Rank > 0);
+
+public:
+  /* Static properties:
+   *  @ndims: number of array dimensions.
+   */
+  static constexpr std::size_t ndims = Rank;
+
+  /* Type information:
+   *   base_type: type of each array element.
+   *   index_type: type of accepted indices to operator[].
+   */
+  using base_type = Type;
+  using index_type = std::array<std::size_t, Rank>;
+
+  /* vector_type
+   *
+   * Strided view of the elements of an array along one dimension,
+   * passed to the functions of foreach_vector().
+   */
+  class vector_type {
+  public:
+    /* vector_type(): constructor. */
+    vector_type (Type* ptr, std::size_t n, std::size_t s)
+     : x(ptr), len(n), step(s) {}
+
+    /* operator[](): access the i'th element of the view. */
+    Type& operator[] (std::size_t i) const { return x[i * step]; }
+
+    /* data(), size(), stride(): view geometry. */
+    Type* data () const { return x; }
+    std::size_t size () const { return len; }
+    std::size_t stride () const { return step; }
+
+  private:
+    /* View state:
+     *  @x: first element of the view.
+     *  @len: number of elements of the view.
+     *  @step: in-memory spacing of the elements.
+     */
+    Type* x;
+    std::size_t len, step;
+  };
+
+  /* is_operand<T>
+   *
+   * Whether a type is accepted by the assignment operators: either
+   * a non-indexable value, or a dynarray or expression of dynarrays
+   * that shares the index type of the array. Operands must have the
+   * same shape as the array, or std::length_error is thrown.
+   */
+  template<typename T>
+  static constexpr bool is_operand =
+    !hx::op::is_indexable_v<T> ||
+    (hx::op::has_index_v<T, index_type> && hx::op::is_flat_v<T>);
+
+  /* dynarray()
+   *
+   * Constructor taking the size of each array dimension.
+   * All elements are value-initialized.
+   */
+  explicit dynarray (const index_type& sizes) : extent(sizes) {
+    std::size_t n = 1;
+    for (std::size_t d = Rank; d > 0; d--) {
+      steps[d - 1] = n;
+      n *= extent[d - 1];
+    }
+
+    elems.resize(n);
+  }
+
+  /* delete the implicit copy constructor. */
+  dynarray (const dynarray& x) = delete;
+
+  /* dynarray(dynarray&&): move constructor. */
+  dynarray (dynarray&& x) = default;
+
+  /* operator=(dynarray&&): move assignment operator. */
+  dynarray& operator= (dynarray&& x) = default;
+
+  /* operator=(dynarray)
+   *
+   * Assignment operator copying the elements of an array
+   * of the same shape.
+   */
+  dynarray& operator= (const dynarray& x) {
+    return assign(hx::exec::seq, x);
+  }
+
+  /* size(): total number of array elements. */
+  std::size_t size () const { return elems.size(); }
+
+  /* shape(): number of elements along dimension d. */
+  std::size_t shape (std::size_t d) const { return extent[d]; }
+
+  /* stride(): in-memory spacing of dimension d. */
+  std::size_t stride (std::size_t d) const { return steps[d]; }
+
+  /* operator[](index_type) */
+  Type& operator[] (const index_type& idx) {
+    return elems[offset(idx)];
+  }
+
+  /* operator[](index_type) const */
+  Type operator[] (const index_type& idx) const {
+    return elems[offset(idx)];
+  }
+
+  /* operator=(value or expression)
+   *
+   * Assignment operator from scalar values and array expressions.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& operator= (const T& rhs) {
+    return assign(hx::exec::seq, rhs);
+  }
+
+  /* assign()
+   *
+   * Assign a scalar value, array or array expression to all array
+   * elements under an execution policy.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& assign (hx::exec::policy p, const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x = y; }, p);
+  }
+
+  /* operator+=()
+   *
+   * Compound addition operator from scalar values, arrays and array
+   * expressions, evaluated in a single in-place pass.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& operator+= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& operator-= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& operator*= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  dynarray& operator/= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x /= y; });
+  }
+
+  /* reduce()
+   *
+   * Reduce an array to a single element through a general lambda
+   * function, under an optional execution policy.
+   */
+  template<typename Lambda>
+  Type reduce (const Lambda& f) const {
+    return reduce(hx::exec::seq, f);
+  }
+
+  /* reduce(policy) */
+  template<typename Lambda>
+  Type reduce (hx::exec::policy p, const Lambda& f) const {
+    const Type* x = raw_data();
+    return hx::exec::reduce(p, size(), grain(),
+      [x] (std::size_t i) { return x[i]; }, f);
+  }
+
+  /* min() */
+  auto min (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a < b ? a : b;
+    });
+  }
+
+  /* max() */
+  auto max (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a > b ? a : b;
+    });
+  }
+
+  /* sum() */
+  auto sum (hx::exec::policy p = hx::exec::seq,
+            hx::exec::compensation c = hx::exec::none) const {
+    const Type* x = raw_data();
+    return hx::exec::sum(p, c, size(), grain(),
+      [x] (std::size_t i) { return x[i]; });
+  }
+
+  /* prod() */
+  auto prod (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a * b;
+    });
+  }
+
+  /* foreach_vector()
+   *
+   * Execute a function for each vector along dimension d of an
+   * array. The function should accept a vector_type as its only
+   * argument. Parallel policies may call the function concurrently
+   * on different vectors.
+   */
+  template<typename Lambda>
+  void foreach_vector (std::size_t d, const Lambda& f) {
+    foreach_vector(hx::exec::seq, d, f);
+  }
+
+  /* foreach_vector(policy) */
+  template<typename Lambda>
+  void foreach_vector (hx::exec::policy p, std::size_t d,
+                       const Lambda& f) {
+    if (size() == 0)
+      return;
+
+    Type* x = raw_data();
+    const std::size_t n = extent[d];
+    const std::size_t step = steps[d];
+    const std::size_t count = size() / n;
+    const std::size_t per = std::max<std::size_t>(1, grain() / n);
+
+    hx::exec::for_range(p, count, per,
+      [x, n, step, &f] (std::size_t j0, std::size_t j1) {
+        for (std::size_t j = j0; j < j1; j++) {
+          const std::size_t base = (j / step) * n * step + j % step;
+          f(vector_type{x + base, n, step});
+        }
+      });
+  }
+
+  /* foreach()
+   *
+   * Execute a function for each element of an array, under
+   * an optional execution policy.
+   */
+  template<typename Lambda>
+  void foreach (const Lambda& f) {
+    foreach(hx::exec::seq, f);
+  }
+
+  /* foreach(policy) */
+  template<typename Lambda>
+  void foreach (hx::exec::policy p, const Lambda& f) {
+    Type* x = raw_data();
+    hx::exec::for_range(p, size(), grain(),
+      [x, &f] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          f(x[i]);
+      });
+  }
+
+  /* raw_data()
+   *
+   * Return a pointer to the raw array of Type's.
+   */
+  Type* raw_data () { return elems.data(); }
+
+  /* raw_data() const */
+  const Type* raw_data () const { return elems.data(); }
+
+private:
+  /* Internal state:
+   *  @extent: number of elements along each dimension.
+   *  @steps: in-memory spacing of each dimension.
+   *  @elems: heap storage of all array elements.
+   */
+  index_type extent;
+  index_type steps;
+  std::vector<Type> elems;
+
+  /* offset(): linear offset of an index. */
+  std::size_t offset (const index_type& idx) const {
+    std::size_t off = 0;
+    for (std::size_t d = 0; d < Rank; d++)
+      off += idx[d] * steps[d];
+
+    return off;
+  }
+
+  /* grain(): number of elements of each task under parallel policies. */
+  std::size_t grain () const {
+    return hx::exec::grain<Type>(steps[0]);
+  }
+
+  /* same_shape()
+   *
+   * Check that every array operand of a value or expression has
+   * the shape of the array.
+   */
+  template<typename T>
+  bool same_shape (const T& rhs) const {
+    return hx::op::all_leaves(rhs, [this] (const auto& leaf) {
+      for (std::size_t d = 0; d < Rank; d++)
+        if (leaf.shape(d) != extent[d])
+          return false;
+
+      return true;
+    });
+  }
+
+  /* update()
+   *
+   * Implementation of the assignment and compound assignment operators.
+   * Values are applied directly, and operands are evaluated at linear
+   * offsets. Operands of a different shape throw std::length_error.
+   */
+  template<typename T, typename Op>
+  dynarray& update (const T& rhs, const Op& op,
+                    hx::exec::policy p = hx::exec::seq) {
+    if (!same_shape(rhs))
+      throw std::length_error("hx::dynarray: operand shape mismatch");
+
+    Type* x = raw_data();
+    hx::exec::for_range(p, size(), grain(),
+      [x, &rhs, &op] (std::size_t i0, std::size_t i1) {
+        if constexpr (!hx::op::is_indexable_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], rhs);
+        }
+        else {
+          for (std::size_t i = i0; i < i1; i++)
+            op(x[i], hx::op::flat(rhs, i));
+        }
+      });
+
+    return *this;
+  }
+};
+
+/* is_array<dynarray<Type, Rank>>
+ *
+ * Dynamic-extent arrays accept the same element-wise
+ * operators and functions as hx::array.
+ */
+template<typename Type, std::size_t Rank>
+struct is_array<hx::dynarray<Type, Rank>> : public std::true_type {};
+
+/* namespace hx */ }
@@ -0,0 +1,500 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+namespace hx::exec {
+
+/* hx::exec::policy
+ *
+ * Enumeration of the execution policies accepted by array-wide
+ * operations:
+ *  @seq: run on the calling thread only.
+ *  @par: partition the work into tasks run on the shared pool.
+ *  @par_simd: as par, for element-wise work that should also be
+ *   vectorized within each task.
+ */
+enum policy : int { seq, par, par_simd };
+
+/* hx::exec::compensation
+ *
+ * Enumeration of the compensated summation schemes accepted by
+ * sum reductions:
+ *  @none: plain pairwise summation.
+ *  @kahan: Kahan summation, carrying a running error term.
+ *  @neumaier: exact error-free (two-sum) transformation of every
+ *   addition, robust to terms larger than the running sum.
+ */
+enum compensation : int { none, kahan, neumaier };
+
+/* hx::exec::task_bytes
+ *
+ * Approximate number of bytes touched by each task, chosen so that
+ * a task fits comfortably within a per-core cache.
+ */
+inline constexpr std::size_t task_bytes = 1 << 18;
+
+/* hx::exec::llc_bytes
+ *
+ * Assumed size of the last-level cache, in bytes, for choices that
+ * are fixed at compile time. hx::cache_bytes() also falls back to
+ * this value when the cache size cannot be queried at run time.
+ */
+inline constexpr std::size_t llc_bytes = std::size_t(1) << 25;
+
+/* grain<Type>()
+ *
+ * Return the number of elements of each task over an array of Type's,
+ * a whole number of outermost slabs of @inner elements each.
+ */
+template<typename Type>
+inline constexpr std::size_t grain (std::size_t inner) {
+  const std::size_t slab = (inner > 0 ? inner : 1);
+  const std::size_t rows = task_bytes / (slab * sizeof(Type));
+  return (rows > 0 ? rows : 1) * slab;
+}
+
+/* hx::exec::pool
+ *
+ * Work-stealing thread pool. Each call to run() splits its tasks into
+ * one contiguous range per participant (the workers and the calling
+ * thread), and participants that exhaust their own range steal half
+ * of the remaining range of another.
+ *
+ * Calls to run() made from within a task of the pool, on a worker or
+ * on the calling thread, execute their tasks inline. The first
+ * exception thrown by a task is rethrown to the caller of run().
+ */
+class pool {
+public:
+  /* pool()
+   *
+   * Constructor taking the total number of participating threads,
+   * including the caller, and whether workers are pinned to cores.
+   */
+  pool (std::size_t threads = std::thread::hardware_concurrency(),
+        bool pin = false)
+   : job(nullptr), generation(0), active(0), remaining(0), stop(false),
+     failed(false) {
+    const std::size_t n = (threads > 0 ? threads : 1);
+    for (std::size_t p = 0; p < n; p++)
+      queues.push_back(std::make_unique<queue>());
+
+    for (std::size_t p = 1; p < n; p++)
+      workers.emplace_back([this, p, pin] () { loop(p, pin); });
+  }
+
+  /* delete the copy constructor. */
+  pool (const pool& other) = delete;
+
+  /* ~pool()
+   *
+   * Destructor. Stops and joins all workers.
+   */
+  ~pool () {
+    {
+      std::lock_guard<std::mutex> lk(m);
+      stop = true;
+    }
+
+    cv.notify_all();
+    for (auto& w : workers)
+      w.join();
+  }
+
+  /* size(): number of participating threads. */
+  std::size_t size () const { return queues.size(); }
+
+  /* run()
+   *
+   * Execute f(t) for every task t < ntasks, returning only
+   * once all tasks have completed.
+   */
+  template<typename F>
+  void run (std::size_t ntasks, const F& f) {
+    if (workers.empty() || ntasks < 2 || inside()) {
+      for (std::size_t t = 0; t < ntasks; t++)
+        f(t);
+
+      return;
+    }
+
+    std::lock_guard<std::mutex> serial(run_mutex);
+    const std::function<void(std::size_t)> fn = f;
+    const nested guard;
+    error = nullptr;
+    failed = false;
+
+    /* deal out one contiguous range of tasks to each participant. */
+    const std::size_t np = queues.size();
+    for (std::size_t p = 0; p < np; p++) {
+      std::lock_guard<std::mutex> lk(queues[p]->m);
+      queues[p]->begin = p * ntasks / np;
+      queues[p]->end = (p + 1) * ntasks / np;
+    }
+
+    remaining = ntasks;
+    {
+      std::lock_guard<std::mutex> lk(m);
+      job = &fn;
+      generation++;
+    }
+
+    cv.notify_all();
+    work(0, fn);
+
+    std::unique_lock<std::mutex> lk(m);
+    done.wait(lk, [this] { return remaining == 0 && active == 0; });
+    job = nullptr;
+
+    if (error)
+      std::rethrow_exception(std::exchange(error, nullptr));
+  }
+
+private:
+  /* queue: range of task indices owned by a participant. */
+  struct queue {
+    std::mutex m;
+    std::size_t begin = 0, end = 0;
+  };
+
+  /* Internal state:
+   *  @workers: worker threads, participants 1, 2, ...
+   *  @queues: task ranges of each participant.
+   *  @job: task function of the current run() call.
+   *  @generation: number of run() calls that have woken workers.
+   *  @active: number of workers executing the current job.
+   *  @remaining: number of tasks not yet completed.
+   *  @stop: whether the workers should exit.
+   *  @failed: whether a task of the current job has thrown.
+   *  @error: first exception thrown by a task of the current job.
+   */
+  std::vector<std::thread> workers;
+  std::vector<std::unique_ptr<queue>> queues;
+  const std::function<void(std::size_t)>* job;
+  std::size_t generation, active;
+  std::atomic<std::size_t> remaining;
+  bool stop;
+  std::atomic<bool> failed;
+  std::exception_ptr error;
+
+  /* Synchronization:
+   *  @m, @cv, @done: guard and signal the job state.
+   *  @run_mutex: serializes concurrent calls to run().
+   */
+  std::mutex m, run_mutex;
+  std::condition_variable cv, done;
+
+  /* inside()
+   *
+   * Return whether the current thread is executing tasks of a pool.
+   */
+  static bool& inside () {
+    thread_local bool flag = false;
+    return flag;
+  }
+
+  /* nested: marks the calling thread as inside the pool while alive. */
+  struct nested {
+    nested () { inside() = true; }
+    ~nested () { inside() = false; }
+  };
+
+  /* next()
+   *
+   * Take the next task of a participant, stealing from
+   * the others once its own range is exhausted.
+   */
+  bool next (std::size_t self, std::size_t& task) {
+    {
+      std::lock_guard<std::mutex> lk(queues[self]->m);
+      if (queues[self]->begin < queues[self]->end) {
+        task = queues[self]->begin++;
+        return true;
+      }
+    }
+
+    const std::size_t np = queues.size();
+    for (std::size_t k = 1; k < np; k++) {
+      queue& victim = *queues[(self + k) % np];
+      std::size_t lo, hi;
+      {
+        std::lock_guard<std::mutex> lk(victim.m);
+        if (victim.begin >= victim.end)
+          continue;
+
+        hi = victim.end;
+        lo = hi - (hi - victim.begin + 1) / 2;
+        victim.end = lo;
+      }
+
+      task = lo;
+      std::lock_guard<std::mutex> lk(queues[self]->m);
+      queues[self]->begin = lo + 1;
+      queues[self]->end = hi;
+      return true;
+    }
+
+    return false;
+  }
+
+  /* work()
+   *
+   * Execute tasks of the current job until none remain. Once any
+   * task has thrown, the remaining tasks are skipped.
+   */
+  void work (std::size_t self, const std::function<void(std::size_t)>& fn) {
+    std::size_t t;
+    while (next(self, t)) {
+      if (!failed) {
+        try {
+          fn(t);
+        }
+        catch (...) {
+          std::lock_guard<std::mutex> lk(m);
+          if (!error)
+            error = std::current_exception();
+
+          failed = true;
+        }
+      }
+
+      if (--remaining == 0) {
+        std::lock_guard<std::mutex> lk(m);
+        done.notify_all();
+      }
+    }
+  }
+
+  /* loop()
+   *
+   * Main function of each worker thread.
+   */
+  void loop (std::size_t self, bool pin) {
+    inside() = true;
+#if defined(__linux__)
+    if (pin) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(self % std::max(1u, std::thread::hardware_concurrency()), &set);
+      pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+#endif
+
+    std::size_t seen = 0;
+    while (true) {
+      const std::function<void(std::size_t)>* fn;
+      {
+        std::unique_lock<std::mutex> lk(m);
+        cv.wait(lk, [&] { return stop || generation != seen; });
+        if (stop)
+          return;
+
+        seen = generation;
+        fn = job;
+        if (!fn)
+          continue;
+
+        active++;
+      }
+
+      work(self, *fn);
+      {
+        std::lock_guard<std::mutex> lk(m);
+        active--;
+      }
+
+      done.notify_all();
+    }
+  }
+};
+
+/* instance()
+ *
+ * Return the storage of the shared pool.
+ */
+inline std::unique_ptr<hx::exec::pool>& instance () {
+  static std::unique_ptr<hx::exec::pool> p;
+  return p;
+}
+
+/* shared()
+ *
+ * Return the pool shared by all parallel array operations,
+ * creating it with one thread per core on first use.
+ */
+inline hx::exec::pool& shared () {
+  auto& p = instance();
+  if (!p)
+    p = std::make_unique<hx::exec::pool>();
+
+  return *p;
+}
+
+/* configure()
+ *
+ * Replace the shared pool by one with the given number of threads,
+ * optionally pinned to cores. Must not be called while any parallel
+ * operation is in progress.
+ */
+inline void configure (std::size_t threads, bool pin = false) {
+  instance() = std::make_unique<hx::exec::pool>(threads, pin);
+}
+
+/* for_range()
+ *
+ * Execute f(i0, i1) over consecutive ranges of @grain offsets
+ * covering [0, n), on the shared pool unless the policy is seq.
+ */
+template<typename F>
+inline void for_range (hx::exec::policy p, std::size_t n,
+                       std::size_t grain, const F& f) {
+  if (p == hx::exec::seq || n <= grain) {
+    f(std::size_t(0), n);
+    return;
+  }
+
+  const std::size_t ntasks = (n + grain - 1) / grain;
+  shared().run(ntasks, [&f, n, grain] (std::size_t t) {
+    f(t * grain, std::min(n, (t + 1) * grain));
+  });
+}
+
+/* Reduction tree shape:
+ *  @leaf: number of consecutive elements reduced by each leaf.
+ *  @lanes: number of interleaved accumulators within each leaf.
+ */
+inline constexpr std::size_t leaf = 1024;
+inline constexpr std::size_t lanes = 4;
+
+/* accumulate()
+ *
+ * Reduce the values get(i) for i in [i0, i1) through op(), using
+ * interleaved accumulators that are combined pairwise at the end.
+ */
+template<typename Get, typename Op>
+inline auto accumulate (std::size_t i0, std::size_t i1,
+                        const Get& get, const Op& op) {
+  std::size_t i = i0;
+  if (i1 - i0 >= 2 * lanes) {
+    auto v0 = get(i), v1 = get(i + 1), v2 = get(i + 2), v3 = get(i + 3);
+    for (i += lanes; i + lanes <= i1; i += lanes) {
+      v0 = op(v0, get(i));
+      v1 = op(v1, get(i + 1));
+      v2 = op(v2, get(i + 2));
+      v3 = op(v3, get(i + 3));
+    }
+
+    auto value = op(op(v0, v1), op(v2, v3));
+    for (; i < i1; i++)
+      value = op(value, get(i));
+
+    return value;
+  }
+
+  auto value = get(i);
+  for (i++; i < i1; i++)
+    value = op(value, get(i));
+
+  return value;
+}
+
+/* combine()
+ *
+ * Reduce n values pairwise, splitting each range at its midpoint.
+ */
+template<typename V, typename Op>
+inline V combine (const V* v, std::size_t n, const Op& op) {
+  if (n == 1)
+    return v[0];
+
+  const std::size_t h = n / 2;
+  return op(hx::exec::combine(v, h, op), hx::exec::combine(v + h, n - h, op));
+}
+
+/* reduce()
+ *
+ * Reduce the values get(i) for i in [0, n) through op(). The shape
+ * of the reduction is fixed by n alone: each leaf of consecutive
+ * elements is accumulated in lanes, and the leaf results are then
+ * combined pairwise. Parallel policies compute the leaves in tasks
+ * of about @grain elements, so results are bitwise identical for
+ * every policy and thread count. Empty ranges reduce to a value
+ * initialized result.
+ */
+template<typename Get, typename Op>
+inline auto reduce (hx::exec::policy p, std::size_t n, std::size_t grain,
+                    const Get& get, const Op& op) {
+  using V = decltype(accumulate(0, n, get, op));
+  const std::size_t nleaf = (n + leaf - 1) / leaf;
+  if (nleaf == 0)
+    return V{};
+
+  if (nleaf == 1)
+    return accumulate(0, n, get, op);
+
+  std::vector<V> part(nleaf);
+
+  const std::size_t per = std::max<std::size_t>(1, grain / leaf);
+  for_range(p, nleaf, per, [&] (std::size_t l0, std::size_t l1) {
+    for (std::size_t l = l0; l < l1; l++)
+      part[l] = accumulate(l * leaf, std::min(n, (l + 1) * leaf), get, op);
+  });
+
+  return hx::exec::combine(part.data(), nleaf, op);
+}
+
+/* sum()
+ *
+ * Sum the values get(i) for i in [0, n) by reduce(), optionally
+ * carrying an error term with each partial sum.
+ */
+template<typename Get>
+inline auto sum (hx::exec::policy p, hx::exec::compensation c,
+                 std::size_t n, std::size_t grain, const Get& get) {
+  using V = decltype(get(std::size_t(0)));
+  using state = std::pair<V, V>;
+
+  const auto value = [&get] (std::size_t i) { return state{get(i), V{}}; };
+  const auto total = [] (const state& st) { return st.first + st.second; };
+
+  if (c == hx::exec::kahan) {
+    return total(reduce(p, n, grain, value,
+      [] (const state& a, const state& b) {
+        const V y = b.first + (b.second + a.second);
+        const V t = a.first + y;
+        return state{t, y - (t - a.first)};
+      }));
+  }
+  else if (c == hx::exec::neumaier) {
+    return total(reduce(p, n, grain, value,
+      [] (const state& a, const state& b) {
+        const V t = a.first + b.first;
+        const V bv = t - a.first;
+        const V e = (a.first - (t - bv)) + (b.first - bv);
+        return state{t, (a.second + b.second) + e};
+      }));
+  }
+
+  return reduce(p, n, grain, get,
+    [] (const V& a, const V& b) { return a + b; });
+}
+
+/* namespace hx::exec */ }
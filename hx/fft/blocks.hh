@@ -6,168 +6,57 @@
 #pragma once
 
 #include <array>
+#include <vector>
 
 namespace hx::fft {
 
-/* hx::fft::block<Type,Dir,Dim,N,Stride>
+/* hx::fft::radix<Type,Dir,Dim,N>
  *
- * Implementation of the fast discrete Fourier transform (FFT) based
- * on the general Cooley-Tukey decimation-in-time index mapping.
+ * Butterfly kernels that compute N-point discrete Fourier transforms
+ * of vectors with a run-time stride. Only the radices supported by
+ * hx::fft::plan are specialized.
  */
 template<typename Type, hx::fft::direction Dir, std::size_t Dim,
-         std::size_t N, std::size_t Stride>
-class block {
-public:
-  /* operator()()
-   *
-   * Apply the recursion to a specified vector of Type's.
-   */
-  template<typename Ptr>
-  void operator() (Ptr x) const {
-    /* execute N1 transforms of size N2. */
-    for (std::size_t i = 0; i < N1; i++)
-      blk2(x + S1 * i);
-
-    /* apply twiddle factors using trigonometric recurrences. */
-    for (std::size_t n1 = 1; n1 < N1; n1++) {
-      const Type dw = W[n1];
-      Type w = Type::R();
-
-      for (std::size_t k2 = 0; k2 < N2; k2++) {
-        const std::size_t idx = Stride * (n1 + N1 * k2);
-        x[idx] = x[idx] * w;
-        w -= dw * w;
-      }
-    }
-
-    /* execute N2 strided transforms of size N1. */
-    for (std::size_t i = 0; i < N2; i++)
-      blk1(x + S2 * i);
-
-    /* apply the shuffle operator. */
-    shuf(x);
-  }
-
-private:
-  /* Scalar: multicomplex scalar type of dimensionality Dim. */
-  using Scalar = hx::scalar<Dim>;
-
-  /* next_factor()
-   *
-   * Return the next available value by which we can decompose
-   * the current level of computation.
-   */
-  static constexpr std::size_t next_factor () {
-    constexpr std::size_t F =
-      N %  2 == 0 ?  2 :
-      N %  3 == 0 ?  3 :
-      N %  5 == 0 ?  5 : 0;
-
-    static_assert(F > 0);
-    return F;
-  }
-
-  /* twiddles_elem()
-   *
-   * Compute the n'th 'phase shift' used to update the twiddle factors
-   * via trigonometric recurrences.
-   */
-  template<std::size_t n>
-  static constexpr auto twiddles_elem () {
-    /* compute the recurrence relation coefficients. */
-    constexpr double sp2 = double(Dir) * hx::sin_v<n, N>;
-    constexpr double beta = double(Dir) * hx::sin_v<2*n, N>;
-    constexpr double alpha = 2 * sp2 * sp2;
-
-    /* build and return a Type from the computed coefficients. */
-    return Type{Scalar::R() * alpha - Scalar::I() * beta};
-  }
+         std::size_t N>
+class radix;
 
-  /* twiddles_impl()
-   *
-   * Return an array of phase shifts for a set of powers Ids...
-   */
-  template<std::size_t... Ids>
-  static constexpr auto twiddles_impl (std::index_sequence<Ids...> ids)
-  -> std::array<Type, sizeof...(Ids)> {
-    return {{ twiddles_elem<Ids>()... }};
-  }
-
-  /* twiddles()
-   *
-   * Return an array of n twiddle factor phase shift values.
-   */
-  template<std::size_t n>
-  static constexpr auto twiddles () {
-    return twiddles_impl(std::make_index_sequence<n>());
-  }
-
-  /* Cooley-Tukey decomposition, i.e.: N = N1 * N2
-   *
-   *  Factorization at the current layer:
-   *   @N1: supported prime point count.
-   *   @N2: remaining point count.
-   *
-   *  Strides of each block in the current layer:
-   *   @S1: Stride of the right-hand-side block.
-   *   @S2: Stride of the left-hand-side block.
-   *
-   *  Twiddle factor recurrences in the current layer:
-   *   @W: array of twiddle factor 'phase shift' values.
-   *
-   *  Shuffle operator:
-   *   @shuf: precompiled set of indices to swap to obtain the correct order.
-   */
-  static constexpr std::size_t N1 = next_factor();
-  static constexpr std::size_t N2 = N / N1;
-  static constexpr std::size_t S1 = Stride;
-  static constexpr std::size_t S2 = N1 * Stride;
-  static constexpr auto W = twiddles<N1>();
-  static constexpr auto shuf = hx::fft::shuffle<Type, N2, N1, Stride>{};
-
-  /* Cooley-Tukey recursions:
-   *  @blk1: sub-fft over N1-element subvectors.
-   *  @blk2: sub-fft over N2-element subvectors.
-   */
-  hx::fft::block<Type, Dir, Dim, N1, S1> blk1;
-  hx::fft::block<Type, Dir, Dim, N2, S2> blk2;
-};
-
-/* hx::fft::block<N=2>
+/* hx::fft::radix<N=2>
  *
- * Partial specialization of hx::fft::block for computing
+ * Partial specialization of hx::fft::radix for computing
  * 2-point discrete Fourier transforms.
  */
-template<typename Type, hx::fft::direction Dir,
-         std::size_t Dim, std::size_t Stride>
-class block<Type, Dir, Dim, 2, Stride> {
+template<typename Type, hx::fft::direction Dir, std::size_t Dim>
+class radix<Type, Dir, Dim, 2> {
 public:
   /* operator()() */
   template<typename Ptr>
-  void operator() (Ptr x) const {
-    const Type xd = x[0] - x[Stride];
-    x[0] += x[Stride];
-    x[Stride] = xd;
+  void operator() (Ptr x, std::size_t stride) const {
+    const Type x0 = x[0];
+    const Type x1 = x[stride];
+
+    x[0] = x0 + x1;
+    x[stride] = x0 - x1;
   }
 };
 
-/* hx::fft::block<N=3, Dir=fwd>
+/* hx::fft::radix<N=3, Dir=fwd>
  *
- * Partial specialization of hx::fft::block for computing
+ * Partial specialization of hx::fft::radix for computing
  * 3-point forward discrete Fourier transforms.
  */
-template<typename Type, std::size_t Dim, std::size_t Stride>
-class block<Type, hx::fft::fwd, Dim, 3, Stride> {
+template<typename Type, std::size_t Dim>
+class radix<Type, hx::fft::fwd, Dim, 3> {
 public:
   /* operator()() */
   template<typename Ptr>
-  void operator() (Ptr x) const {
-    const Type x1 = x[Stride];
-    const Type x2 = x[2 * Stride];
-
-    x[Stride]     = x[0] + x1 * w1 + x2 * w2;
-    x[2 * Stride] = x[0] + x1 * w2 + x2 * w4;
-    x[0] += x1 + x2;
+  void operator() (Ptr x, std::size_t stride) const {
+    const Type x0 = x[0];
+    const Type x1 = x[stride];
+    const Type x2 = x[2 * stride];
+
+    x[stride]     = x0 + x1 * w1 + x2 * w2;
+    x[2 * stride] = x0 + x1 * w2 + x2 * w4;
+    x[0] = x0 + (x1 + x2);
   }
 
 private:
@@ -177,23 +66,24 @@ private:
   static constexpr auto w4 = Type{Scalar::template expm<2*4, 3>()};
 };
 
-/* hx::fft::block<N=3, Dir=inv>
+/* hx::fft::radix<N=3, Dir=inv>
  *
- * Partial specialization of hx::fft::block for computing
+ * Partial specialization of hx::fft::radix for computing
  * 3-point inverse discrete Fourier transforms.
  */
-template<typename Type, std::size_t Dim, std::size_t Stride>
-class block<Type, hx::fft::inv, Dim, 3, Stride> {
+template<typename Type, std::size_t Dim>
+class radix<Type, hx::fft::inv, Dim, 3> {
 public:
   /* operator()() */
   template<typename Ptr>
-  void operator() (Ptr x) const {
-    const Type x1 = x[Stride];
-    const Type x2 = x[2 * Stride];
-
-    x[Stride]     = x[0] + x1 * w1 + x2 * w2;
-    x[2 * Stride] = x[0] + x1 * w2 + x2 * w4;
-    x[0] += x1 + x2;
+  void operator() (Ptr x, std::size_t stride) const {
+    const Type x0 = x[0];
+    const Type x1 = x[stride];
+    const Type x2 = x[2 * stride];
+
+    x[stride]     = x0 + x1 * w1 + x2 * w2;
+    x[2 * stride] = x0 + x1 * w2 + x2 * w4;
+    x[0] = x0 + (x1 + x2);
   }
 
 private:
@@ -203,27 +93,28 @@ private:
   static constexpr auto w4 = Type{Scalar::template exp<2*4, 3>()};
 };
 
-/* hx::fft::block<N=5, Dir=fwd>
+/* hx::fft::radix<N=5, Dir=fwd>
  *
- * Partial specialization of hx::fft::block for computing
+ * Partial specialization of hx::fft::radix for computing
  * 5-point forward discrete Fourier transforms.
  */
-template<typename Type, std::size_t Dim, std::size_t Stride>
-class block<Type, hx::fft::fwd, Dim, 5, Stride> {
+template<typename Type, std::size_t Dim>
+class radix<Type, hx::fft::fwd, Dim, 5> {
 public:
   /* operator()() */
   template<typename Ptr>
-  void operator() (Ptr x) const {
-    const Type x1 = x[Stride];
-    const Type x2 = x[2 * Stride];
-    const Type x3 = x[3 * Stride];
-    const Type x4 = x[4 * Stride];
-
-    x[Stride]     = x[0] + x1 * w1 + x2 * w2 + x3 * w3  + x4 * w4;
-    x[2 * Stride] = x[0] + x1 * w2 + x2 * w4 + x3 * w6  + x4 * w8;
-    x[3 * Stride] = x[0] + x1 * w3 + x2 * w6 + x3 * w9  + x4 * w12;
-    x[4 * Stride] = x[0] + x1 * w4 + x2 * w8 + x3 * w12 + x4 * w16;
-    x[0] += x1 + x2 + x3 + x4;
+  void operator() (Ptr x, std::size_t stride) const {
+    const Type x0 = x[0];
+    const Type x1 = x[stride];
+    const Type x2 = x[2 * stride];
+    const Type x3 = x[3 * stride];
+    const Type x4 = x[4 * stride];
+
+    x[stride]     = x0 + x1 * w1 + x2 * w2 + x3 * w3  + x4 * w4;
+    x[2 * stride] = x0 + x1 * w2 + x2 * w4 + x3 * w6  + x4 * w8;
+    x[3 * stride] = x0 + x1 * w3 + x2 * w6 + x3 * w9  + x4 * w12;
+    x[4 * stride] = x0 + x1 * w4 + x2 * w8 + x3 * w12 + x4 * w16;
+    x[0] = x0 + (x1 + x2 + x3 + x4);
   }
 
 private:
@@ -239,27 +130,28 @@ private:
   static constexpr auto w16 = Type{Scalar::template expm<2*16, 5>()};
 };
 
-/* hx::fft::block<N=5, Dir=inv>
+/* hx::fft::radix<N=5, Dir=inv>
  *
- * Partial specialization of hx::fft::block for computing
+ * Partial specialization of hx::fft::radix for computing
  * 5-point inverse discrete Fourier transforms.
  */
-template<typename Type, std::size_t Dim, std::size_t Stride>
-class block<Type, hx::fft::inv, Dim, 5, Stride> {
+template<typename Type, std::size_t Dim>
+class radix<Type, hx::fft::inv, Dim, 5> {
 public:
   /* operator()() */
   template<typename Ptr>
-  void operator() (Ptr x) const {
-    const Type x1 = x[Stride];
-    const Type x2 = x[2 * Stride];
-    const Type x3 = x[3 * Stride];
-    const Type x4 = x[4 * Stride];
-
-    x[Stride]     = x[0] + x1 * w1 + x2 * w2 + x3 * w3  + x4 * w4;
-    x[2 * Stride] = x[0] + x1 * w2 + x2 * w4 + x3 * w6  + x4 * w8;
-    x[3 * Stride] = x[0] + x1 * w3 + x2 * w6 + x3 * w9  + x4 * w12;
-    x[4 * Stride] = x[0] + x1 * w4 + x2 * w8 + x3 * w12 + x4 * w16;
-    x[0] += x1 + x2 + x3 + x4;
+  void operator() (Ptr x, std::size_t stride) const {
+    const Type x0 = x[0];
+    const Type x1 = x[stride];
+    const Type x2 = x[2 * stride];
+    const Type x3 = x[3 * stride];
+    const Type x4 = x[4 * stride];
+
+    x[stride]     = x0 + x1 * w1 + x2 * w2 + x3 * w3  + x4 * w4;
+    x[2 * stride] = x0 + x1 * w2 + x2 * w4 + x3 * w6  + x4 * w8;
+    x[3 * stride] = x0 + x1 * w3 + x2 * w6 + x3 * w9  + x4 * w12;
+    x[4 * stride] = x0 + x1 * w4 + x2 * w8 + x3 * w12 + x4 * w16;
+    x[0] = x0 + (x1 + x2 + x3 + x4);
   }
 
 private:
@@ -275,5 +167,122 @@ private:
   static constexpr auto w16 = Type{Scalar::template exp<2*16, 5>()};
 };
 
-/* namespace hx::fft */ }
+/* hx::fft::engine<Type,Dir,Dim>
+ *
+ * Executor for the stages of an hx::fft::plan. The same (fixed) set of
+ * radix kernels is used for transforms of any length.
+ */
+template<typename Type, hx::fft::direction Dir, std::size_t Dim>
+class engine {
+public:
+  /* swap_list: sequence of index pairs returned by plan::swaps(). */
+  using swap_list = std::vector<std::array<std::size_t, 2>>;
+
+  /* operator()()
+   *
+   * Apply the plan @p to a vector of Type's with stride @stride,
+   * after reordering its points using the swap operations @sw.
+   */
+  template<typename Ptr>
+  void operator() (Ptr x, const hx::fft::plan& p, const swap_list& sw,
+                   std::size_t stride) const {
+    /* move the inputs into digit-reversed order. */
+    for (const auto& idx : sw) {
+      const Type swp = x[stride * idx[0]];
+      x[stride * idx[0]] = x[stride * idx[1]];
+      x[stride * idx[1]] = swp;
+    }
+
+    /* execute each stage of the plan. */
+    for (std::size_t s = 0; s < p.stages(); s++) {
+      switch (p.radix(s)) {
+        case 2: stage(r2, x, p, s, stride); break;
+        case 3: stage(r3, x, p, s, stride); break;
+        case 5: stage(r5, x, p, s, stride); break;
+      }
+    }
+  }
+
+private:
+  /* stage()
+   *
+   * Execute the s'th stage of a plan using the radix-R kernel @kern.
+   */
+  template<std::size_t R, typename Ptr>
+  static void stage (const hx::fft::radix<Type, Dir, Dim, R>& kern,
+                     Ptr x, const hx::fft::plan& p, std::size_t s,
+                     std::size_t stride) {
+    const std::size_t m = p.span(s);
+
+    Type dw[R];
+    for (std::size_t j = 1; j < R; j++)
+      dw[j] = p.template twiddle<Type, Dim>(Dir, s, j);
+
+    for (std::size_t g = 0; g < p.size(); g += R * m) {
+      Ptr xg = x + stride * g;
+
+      /* apply twiddle factors using trigonometric recurrences. */
+      for (std::size_t j = 1; j < R; j++) {
+        Type w = Type::R();
+        w -= dw[j] * w;
+
+        for (std::size_t k = 1; k < m; k++) {
+          const std::size_t idx = stride * (j * m + k);
+          const Type xk = xg[idx];
+          xg[idx] = xk * w;
+          w -= dw[j] * w;
+        }
+      }
+
+      /* execute m strided butterflies of size R. */
+      for (std::size_t k = 0; k < m; k++)
+        kern(xg + stride * k, stride * m);
+    }
+  }
+
+  /* Butterfly kernels:
+   *  @r2, @r3, @r5: kernels of each supported radix.
+   */
+  hx::fft::radix<Type, Dir, Dim, 2> r2;
+  hx::fft::radix<Type, Dir, Dim, 3> r3;
+  hx::fft::radix<Type, Dir, Dim, 5> r5;
+};
 
+/* hx::fft::block<Type,Dir,Dim,N,Stride>
+ *
+ * Implementation of the fast discrete Fourier transform (FFT) based
+ * on the general Cooley-Tukey decimation-in-time index mapping, with
+ * the decomposition of N computed at compile time as a flat plan.
+ */
+template<typename Type, hx::fft::direction Dir, std::size_t Dim,
+         std::size_t N, std::size_t Stride>
+class block {
+public:
+  /* operator()()
+   *
+   * Apply the plan to a specified vector of Type's.
+   */
+  template<typename Ptr>
+  void operator() (Ptr x) const {
+    eng(x, pl, swaps(), Stride);
+  }
+
+private:
+  /* @pl: compile-time decomposition of the transform. */
+  static constexpr hx::fft::plan pl{N};
+  static_assert(pl.valid());
+
+  /* swaps()
+   *
+   * Return the input reordering of the plan, computed on first use.
+   */
+  static const auto& swaps () {
+    static const auto sw = pl.swaps();
+    return sw;
+  }
+
+  /* @eng: stage executor. */
+  hx::fft::engine<Type, Dir, Dim> eng;
+};
+
+/* namespace hx::fft */ }
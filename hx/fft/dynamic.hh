@@ -0,0 +1,67 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::fft {
+
+/* hx::fft::dynamic<Type,Dir,Dim>
+ *
+ * Fast discrete Fourier transform with a length chosen at run time.
+ * The plan is computed on construction and executed by the same
+ * radix kernels as the compile-time hx::fft::transform, so both
+ * produce identical results for equal lengths.
+ */
+template<typename Type, hx::fft::direction Dir, std::size_t Dim = 1>
+class dynamic {
+public:
+  /* dynamic()
+   *
+   * Constructor taking the number of points of the transform. Lengths
+   * that do not satisfy hx::fft::is_good_size() yield a transform for
+   * which valid() is false.
+   */
+  dynamic (std::size_t n) : pl(n), sw(pl.swaps()) {}
+
+  /* size(): number of points of the transform. */
+  std::size_t size () const { return pl.size(); }
+
+  /* valid(): whether the transform can be computed. */
+  bool valid () const { return pl.valid(); }
+
+  /* operator()
+   *
+   * Apply an in-place transform to the provided data vector,
+   * whose points are spaced @stride elements apart. Returns false,
+   * leaving the data unchanged, if the transform is not valid.
+   */
+  template<typename Ptr>
+  bool operator() (Ptr x, std::size_t stride = 1) const {
+    if (!pl.valid())
+      return false;
+
+    if constexpr (std::is_same_v<Type, Wide>)
+      eng(x, pl, sw, stride);
+    else
+      eng(hx::fft::widen<Ptr, Wide>(x), pl, sw, stride);
+
+    return true;
+  }
+
+private:
+  /* Wide: type used for arithmetic within the transform. */
+  using Wide = hx::wide_type_t<Type>;
+
+  /* Transform state:
+   *  @pl: run-time decomposition of the transform.
+   *  @sw: input reordering of the plan.
+   *  @eng: stage executor.
+   */
+  hx::fft::plan pl;
+  typename hx::fft::engine<Wide, Dir, Dim>::swap_list sw;
+  hx::fft::engine<Wide, Dir, Dim> eng;
+};
+
+/* namespace hx::fft */ }
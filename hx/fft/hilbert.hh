@@ -0,0 +1,77 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::fft {
+
+/* hx::fft::hilbert<Type,N,Dim>
+ *
+ * Discrete Hilbert transform along the multicomplex unit Dim, which
+ * replaces the unit-Dim imaginary coefficients of a vector by those
+ * consistent with its unit-Dim real coefficients, e.g. to regenerate
+ * the imaginary part of a spectrum after hx::proc::real.
+ *
+ * The vector is inverse transformed, its negative frequencies are
+ * masked out, and it is forward transformed, all in-place.
+ */
+template<typename Type, std::size_t N, std::size_t Dim>
+class hilbert {
+  static_assert(Dim >= 1 && Dim <= hx::scalar_dims_v<Type>);
+
+public:
+  /* operator()
+   *
+   * Apply an in-place Hilbert transform to the provided data vector.
+   */
+  template<typename Ptr>
+  void operator() (Ptr x) const {
+    /* discard the existing unit-Dim imaginary coefficients. */
+    for (std::size_t n = 0; n < N; n++)
+      x[n] = real(x[n]);
+
+    ifft(x);
+
+    /* keep the zero (and Nyquist) frequency, double the positive
+     * frequencies, and zero the negative frequencies.
+     */
+    for (std::size_t n = 1; n < N; n++) {
+      if (2 * n < N)
+        x[n] = x[n] * 2.0;
+      else if (2 * n > N)
+        x[n] = Type{};
+    }
+
+    fft(x);
+
+    for (std::size_t n = 0; n < N; n++)
+      x[n] = x[n] / double(N);
+  }
+
+private:
+  /* real()
+   *
+   * Return a copy of a scalar with all coefficients involving
+   * the unit Dim set to zero.
+   */
+  static constexpr Type real (Type s) {
+    constexpr std::size_t K = std::size_t(1) << hx::scalar_dims_v<Type>;
+    constexpr std::size_t bit = std::size_t(1) << (Dim - 1);
+    for (std::size_t i = 0; i < K; i++)
+      if (i & bit)
+        s[i] = 0;
+
+    return s;
+  }
+
+  /* Transforms:
+   *  @fft: forward transform along unit Dim.
+   *  @ifft: inverse transform along unit Dim.
+   */
+  hx::fft::forward<Type, N, Dim> fft;
+  hx::fft::inverse<Type, N, Dim> ifft;
+};
+
+/* namespace hx::fft */ }
@@ -0,0 +1,286 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace hx::fft {
+
+/* hx::fft::multi<Array,Dir,Dims...>
+ *
+ * Vector-radix fast Fourier transform along several dimensions of an
+ * array at once, each along its own multicomplex unit (d + 1). Every
+ * transformed dimension must have a power-of-two size.
+ *
+ * Each stage applies 2x2 (or 2x2x2, ...) butterflies over all active
+ * dimensions in a single pass, so a transform over K dimensions makes
+ * log2 of the largest size passes instead of the sum of all log2 sizes,
+ * and applies 2^K - 1 twiddle factors per butterfly instead of the
+ * K 2^(K-1) of a row-column decomposition.
+ */
+template<typename Array, hx::fft::direction Dir, std::size_t... Dims>
+class multi {
+public:
+  /* Type: element type of the array.
+   * K: number of transformed dimensions.
+   */
+  using Type = typename Array::base_type;
+  static constexpr std::size_t K = sizeof...(Dims);
+
+  /* Transform geometry:
+   *  @sizes: number of points of each transformed dimension.
+   *  @strides: in-memory spacing of each transformed dimension.
+   */
+  static constexpr std::size_t sizes[K] = {Array::template shape<Dims>...};
+  static constexpr std::size_t strides[K] = {
+    Array::index_type::template stride<Dims>...
+  };
+
+  static_assert(K > 0 && ((Array::template shape<Dims> >= 2 &&
+    (Array::template shape<Dims> & (Array::template shape<Dims> - 1)) == 0)
+    && ...));
+
+  /* multi()
+   *
+   * Default constructor. Computes the twiddle factors of
+   * each transformed dimension.
+   */
+  multi () {
+    std::size_t d = 0;
+    (init<Dims>(d++), ...);
+  }
+
+  /* operator()()
+   *
+   * Apply an in-place transform to the provided array.
+   */
+  void operator() (Array& arr) const {
+    constexpr std::size_t n = Array::ndims;
+    constexpr auto shape = shapes(std::make_index_sequence<n>());
+    constexpr auto stride = steps(std::make_index_sequence<n>());
+    Type* x = arr.raw_data();
+
+    /* transform each set of points sharing the untransformed indices. */
+    std::size_t idx[n] = {};
+    while (true) {
+      std::size_t off = 0;
+      for (std::size_t d = 0; d < n; d++)
+        off += idx[d] * stride[d];
+
+      apply(x + off);
+
+      /* advance to the next set of untransformed indices. */
+      std::size_t d = n;
+      for (; d > 0; d--) {
+        if (((Dims == d - 1) || ...))
+          continue;
+
+        if (++idx[d - 1] < shape[d - 1])
+          break;
+
+        idx[d - 1] = 0;
+      }
+
+      if (d == 0)
+        break;
+    }
+  }
+
+private:
+  /* Twiddle factors:
+   *  @tw: powers of exp(Dir * I * 2 pi / n) along each dimension,
+   *       for the first n/2 points.
+   */
+  std::vector<Type> tw[K];
+
+  /* init<Dim>()
+   *
+   * Compute the twiddle factors of the d'th transformed dimension.
+   */
+  template<std::size_t Dim>
+  void init (std::size_t d) {
+    using Scalar = hx::scalar<Dim + 1>;
+    const std::size_t n = sizes[d];
+
+    tw[d].resize(n / 2);
+    for (std::size_t k = 0; k < n / 2; k++)
+      tw[d][k] = Type{Scalar::R() * hx::cos_pi(2 * k, n)
+                    + Scalar::I() * (double(Dir) * hx::sin_pi(2 * k, n))};
+  }
+
+  /* shapes(): sizes of all dimensions of the array. */
+  template<std::size_t... Is>
+  static constexpr std::array<std::size_t, sizeof...(Is)>
+  shapes (std::index_sequence<Is...>) {
+    return {{ Array::template shape<Is>... }};
+  }
+
+  /* steps(): in-memory spacing of all dimensions of the array. */
+  template<std::size_t... Is>
+  static constexpr std::array<std::size_t, sizeof...(Is)>
+  steps (std::index_sequence<Is...>) {
+    return {{ Array::index_type::template stride<Is>... }};
+  }
+
+  /* count()
+   *
+   * Advance a K-digit mixed-radix counter with extents @ext,
+   * returning false after the final value.
+   */
+  static bool count (std::size_t (&idx)[K], const std::size_t (&ext)[K]) {
+    for (std::size_t d = K; d > 0; d--) {
+      if (++idx[d - 1] < ext[d - 1])
+        return true;
+
+      idx[d - 1] = 0;
+    }
+
+    return false;
+  }
+
+  /* reverse()
+   *
+   * Return the bit reversal of an index i of n (a power of two).
+   */
+  static std::size_t reverse (std::size_t i, std::size_t n) {
+    std::size_t r = 0;
+    for (std::size_t m = n >> 1; m > 0; m >>= 1, i >>= 1)
+      r = (r << 1) | (i & 1);
+
+    return r;
+  }
+
+  /* apply()
+   *
+   * Transform the K-dimensional block of points at @x.
+   */
+  void apply (Type* x) const {
+    /* bit-reverse the points along each transformed dimension. */
+    for (std::size_t d = 0; d < K; d++) {
+      std::size_t ext[K], idx[K] = {};
+      for (std::size_t e = 0; e < K; e++)
+        ext[e] = (e == d ? 1 : sizes[e]);
+
+      do {
+        std::size_t off = 0;
+        for (std::size_t e = 0; e < K; e++)
+          off += idx[e] * strides[e];
+
+        for (std::size_t i = 0; i < sizes[d]; i++) {
+          const std::size_t j = reverse(i, sizes[d]);
+          if (j > i) {
+            const Type swp = x[off + i * strides[d]];
+            x[off + i * strides[d]] = x[off + j * strides[d]];
+            x[off + j * strides[d]] = swp;
+          }
+        }
+      }
+      while (count(idx, ext));
+    }
+
+    /* execute each stage over all dimensions still being combined. */
+    for (std::size_t m = 1; ; m <<= 1) {
+      /* determine the active dimensions and loop extents. */
+      std::size_t act[K], nact = 0;
+      std::size_t kext[K], gext[K];
+      for (std::size_t d = 0; d < K; d++) {
+        if (m < sizes[d]) {
+          act[nact++] = d;
+          kext[d] = m;
+          gext[d] = sizes[d] / (2 * m);
+        }
+        else {
+          kext[d] = sizes[d];
+          gext[d] = 1;
+        }
+      }
+
+      if (nact == 0)
+        break;
+
+      stage(x, m, act, nact, kext, gext);
+    }
+  }
+
+  /* stage()
+   *
+   * Execute a single stage, combining pairs of transforms of m points
+   * along each of the @nact active dimensions listed in @act.
+   */
+  void stage (Type* x, std::size_t m, const std::size_t (&act)[K],
+              std::size_t nact, const std::size_t (&kext)[K],
+              const std::size_t (&gext)[K]) const {
+    const std::size_t corners = std::size_t(1) << nact;
+
+    /* offsets of the corners of each butterfly. */
+    std::size_t coff[1 << K] = {};
+    for (std::size_t c = 1; c < corners; c++) {
+      const std::size_t b = lowest(c);
+      coff[c] = coff[c & (c - 1)] + m * strides[act[b]];
+    }
+
+    std::size_t k[K] = {};
+    do {
+      /* compute the corner twiddle factors for this point. */
+      Type w[1 << K];
+      w[0] = Type::R();
+      for (std::size_t c = 1; c < corners; c++) {
+        const std::size_t b = lowest(c);
+        const std::size_t d = act[b];
+        w[c] = w[c & (c - 1)] * tw[d][k[d] * (sizes[d] / (2 * m))];
+      }
+
+      std::size_t base = 0;
+      for (std::size_t d = 0; d < K; d++)
+        base += k[d] * strides[d];
+
+      /* apply a butterfly within each group. */
+      std::size_t g[K] = {};
+      do {
+        std::size_t off = base;
+        for (std::size_t d = 0; d < K; d++)
+          off += g[d] * 2 * m * strides[d];
+
+        Type p[1 << K];
+        p[0] = x[off];
+        for (std::size_t c = 1; c < corners; c++)
+          p[c] = x[off + coff[c]] * w[c];
+
+        for (std::size_t b = 1; b < corners; b <<= 1) {
+          for (std::size_t c = 0; c < corners; c++) {
+            if (c & b)
+              continue;
+
+            const Type p0 = p[c];
+            const Type p1 = p[c | b];
+            p[c] = p0 + p1;
+            p[c | b] = p0 - p1;
+          }
+        }
+
+        for (std::size_t c = 0; c < corners; c++)
+          x[off + coff[c]] = p[c];
+      }
+      while (count(g, gext));
+    }
+    while (count(k, kext));
+  }
+
+  /* lowest()
+   *
+   * Return the position of the lowest set bit of c.
+   */
+  static std::size_t lowest (std::size_t c) {
+    std::size_t b = 0;
+    while (!(c & (std::size_t(1) << b)))
+      b++;
+
+    return b;
+  }
+};
+
+/* namespace hx::fft */ }
@@ -0,0 +1,267 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace hx::fft {
+
+/* hx::fft::outofcore<Array,Dir>
+ *
+ * Multidimensional fast Fourier transform of an array that is stored
+ * in a raw file (in the in-memory layout of Array) instead of in RAM.
+ *
+ * The outermost dimension is transformed in blocks of pencils, which
+ * are read row-wise and transposed in memory, and all inner dimensions
+ * are then transformed one contiguous slab at a time. Reads and writes
+ * of neighbouring blocks are overlapped with computation on the current
+ * block. Results are identical to those of the in-memory foreach_dim()
+ * and foreach_vector() approach.
+ */
+template<typename Array, hx::fft::direction Dir>
+class outofcore {
+public:
+  /* outofcore(size_t)
+   *
+   * Constructor taking the approximate number of bytes that may be
+   * used to buffer pencils of the outermost dimension.
+   */
+  outofcore (std::size_t bytes = std::size_t(1) << 28) : budget(bytes) {}
+
+  /* operator()(const char*)
+   *
+   * Apply an in-place transform to the array stored at @path.
+   * Returns false if the file could not be opened, read or written.
+   */
+  bool operator() (const char* path) const {
+    const int fd = ::open(path, O_RDWR);
+    if (fd < 0)
+      return false;
+
+    const bool ok = (*this)(fd);
+    return (::close(fd) == 0) && ok;
+  }
+
+  /* operator()(int)
+   *
+   * Apply an in-place transform to the array stored in the file
+   * referenced by the descriptor @fd, which must allow positioned
+   * reads and writes.
+   */
+  bool operator() (int fd) const {
+    if (!pencils(fd))
+      return false;
+
+    if constexpr (Array::ndims > 1)
+      return slabs(fd);
+    else
+      return true;
+  }
+
+private:
+  /* slab_type<A>: inner sub-array type of multidimensional arrays. */
+  template<typename A, typename = void>
+  struct slab_type { using type = A; };
+  /**/
+  template<typename A>
+  struct slab_type<A, std::void_t<typename A::inner>> {
+    using type = typename A::inner;
+  };
+
+  /* Type: element type of the array.
+   * Slab: array type of a single outermost-dimension slab.
+   */
+  using Type = typename Array::base_type;
+  using Slab = typename slab_type<Array>::type;
+
+  /* Array geometry:
+   *  @rows: number of slabs along the outermost dimension.
+   *  @cols: number of elements in each slab.
+   */
+  static constexpr std::size_t rows = Array::template shape<0>;
+  static constexpr std::size_t cols = Array::size / rows;
+
+  /* pencil_slot: pipeline buffers used while transforming
+   * the outermost dimension.
+   *  @n: number of pencils held in the block.
+   *  @row: block of pencils in file (row-major) order.
+   *  @col: block of pencils in transposed (contiguous) order.
+   */
+  struct pencil_slot {
+    std::size_t n;
+    std::vector<Type> row, col;
+  };
+
+  /* Internal state:
+   *  @budget: number of bytes available for pencil buffering.
+   */
+  std::size_t budget;
+
+  /* transfer()
+   *
+   * Read or write exactly @n bytes at byte offset @off of a file,
+   * retrying short transfers.
+   */
+  static bool transfer (int fd, bool rd, void* ptr,
+                        std::size_t n, std::size_t off) {
+    char* buf = static_cast<char*>(ptr);
+    while (n > 0) {
+      const ssize_t k = rd ? ::pread(fd, buf, n, off)
+                           : ::pwrite(fd, buf, n, off);
+      if (k <= 0)
+        return false;
+
+      buf += k;
+      off += k;
+      n -= k;
+    }
+
+    return true;
+  }
+
+  /* pipeline()
+   *
+   * Execute @n blocks of work through three rotating buffers, so that
+   * the read of block (i+1) and the write of block (i-1) proceed while
+   * block i is being computed.
+   */
+  template<typename Slot, typename Read, typename Compute, typename Write>
+  static bool pipeline (std::size_t n, Slot (&slots)[3], const Read& rd,
+                        const Compute& fn, const Write& wr) {
+    constexpr auto policy = std::launch::async;
+    std::future<bool> rf, wf;
+    bool ok = true;
+
+    if (n == 0)
+      return true;
+
+    rf = std::async(policy, rd, std::size_t(0), std::ref(slots[0]));
+    for (std::size_t i = 0; i < n && ok; i++) {
+      Slot& cur = slots[i % 3];
+      if (!rf.get())
+        return false;
+
+      if (i + 1 < n)
+        rf = std::async(policy, rd, i + 1, std::ref(slots[(i + 1) % 3]));
+
+      fn(cur);
+
+      if (wf.valid())
+        ok = wf.get();
+
+      if (ok)
+        wf = std::async(policy, wr, i, std::ref(cur));
+    }
+
+    return (wf.valid() ? wf.get() : true) && ok;
+  }
+
+  /* pencils()
+   *
+   * Transform the outermost dimension of the array using blocks of
+   * pencils that are transposed into contiguous vectors in memory.
+   */
+  bool pencils (int fd) const {
+    /* determine the number of pencils per block. */
+    std::size_t width = budget / (6 * rows * sizeof(Type));
+    width = (width < 1 ? 1 : width > cols ? cols : width);
+    const std::size_t nblk = (cols + width - 1) / width;
+
+    /* allocate the pipeline buffers. */
+    pencil_slot slots[3];
+    for (auto& s : slots) {
+      s.row.resize(rows * width);
+      s.col.resize(rows * width);
+    }
+
+    /* read: gather each row of the block, then transpose. */
+    auto rd = [fd, width] (std::size_t blk, pencil_slot& s) {
+      const std::size_t c0 = blk * width;
+      const std::size_t w = (c0 + width > cols ? cols - c0 : width);
+      s.n = w;
+
+      for (std::size_t r = 0; r < rows; r++) {
+        const std::size_t off = (r * cols + c0) * sizeof(Type);
+        if (!transfer(fd, true, &s.row[r * w], w * sizeof(Type), off))
+          return false;
+      }
+
+      for (std::size_t r = 0; r < rows; r++)
+        for (std::size_t j = 0; j < w; j++)
+          s.col[j * rows + r] = s.row[r * w + j];
+
+      return true;
+    };
+
+    /* compute: transform each contiguous pencil. */
+    auto fn = [] (pencil_slot& s) {
+      const hx::fft::transform<Type, rows, Dir, 1> f;
+      for (std::size_t j = 0; j < s.n; j++)
+        f(&s.col[j * rows]);
+    };
+
+    /* write: transpose back, then scatter each row of the block. */
+    auto wr = [fd, width] (std::size_t blk, pencil_slot& s) {
+      const std::size_t c0 = blk * width;
+      const std::size_t w = s.n;
+
+      for (std::size_t r = 0; r < rows; r++)
+        for (std::size_t j = 0; j < w; j++)
+          s.row[r * w + j] = s.col[j * rows + r];
+
+      for (std::size_t r = 0; r < rows; r++) {
+        const std::size_t off = (r * cols + c0) * sizeof(Type);
+        if (!transfer(fd, false, &s.row[r * w], w * sizeof(Type), off))
+          return false;
+      }
+
+      return true;
+    };
+
+    return pipeline(nblk, slots, rd, fn, wr);
+  }
+
+  /* slabs()
+   *
+   * Transform all inner dimensions of the array, one contiguous
+   * outermost-dimension slab at a time.
+   */
+  bool slabs (int fd) const {
+    /* allocate the pipeline buffers. */
+    std::unique_ptr<Slab> slots[3];
+    for (auto& s : slots)
+      s = std::make_unique<Slab>();
+
+    /* read and write: transfer one slab of the file. */
+    auto rd = [fd] (std::size_t i, std::unique_ptr<Slab>& s) {
+      const std::size_t n = cols * sizeof(Type);
+      return transfer(fd, true, s->raw_data(), n, i * n);
+    };
+    auto wr = [fd] (std::size_t i, std::unique_ptr<Slab>& s) {
+      const std::size_t n = cols * sizeof(Type);
+      return transfer(fd, false, s->raw_data(), n, i * n);
+    };
+
+    /* compute: transform each dimension of the slab in memory. */
+    auto fn = [] (std::unique_ptr<Slab>& s) {
+      s->foreach_dim([&s] (auto dim) {
+        constexpr std::size_t d = dim.value;
+        const hx::fft::transform<Type, Slab::template shape<d>,
+                                 Dir, d + 2> f;
+        s->template foreach_vector<d>(f);
+      });
+    };
+
+    return pipeline(rows, slots, rd, fn, wr);
+  }
+};
+
+/* namespace hx::fft */ }
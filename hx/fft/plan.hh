@@ -0,0 +1,159 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+namespace hx::fft {
+
+/* hx::fft::plan
+ *
+ * Constexpr-compatible class encoding the flat sequence of stages of
+ * a mixed-radix decimation-in-time transform of n points. Usable both
+ * at compile time (by hx::fft::block) and at run time.
+ *
+ * The points of the transform are first reordered by reverse(), and
+ * each stage s then combines groups of radix(s) contiguous transforms
+ * of span(s) points into transforms of radix(s) * span(s) points.
+ */
+class plan {
+public:
+  /* Plan limits:
+   *  @max_stages: maximum number of stages of any transform.
+   *  @max_radix: largest supported radix.
+   */
+  static constexpr std::size_t max_stages = 64;
+  static constexpr std::size_t max_radix = 5;
+
+  /* plan()
+   *
+   * Constructor taking the number of points of the transform,
+   * which must factor into the radices 2, 3 and 5.
+   */
+  constexpr plan (std::size_t n)
+   : n_points(n), n_stages(0), factors{}, alpha{}, beta{} {
+    /* factor the point count, smallest radices first. */
+    for (std::size_t f : {2, 3, 5}) {
+      while (n > 1 && n % f == 0 && n_stages < max_stages) {
+        factors[n_stages++] = f;
+        n /= f;
+      }
+    }
+
+    /* compute the twiddle factor recurrence coefficients. */
+    for (std::size_t s = 0; s < n_stages; s++) {
+      const std::size_t len = radix(s) * span(s);
+      for (std::size_t j = 1; j < radix(s); j++) {
+        const double sp2 = hx::sin_pi(j, len);
+        alpha[s][j] = 2 * sp2 * sp2;
+        beta[s][j] = hx::sin_pi(2 * j, len);
+      }
+    }
+  }
+
+  /* size(): number of points of the transform. */
+  constexpr std::size_t size () const { return n_points; }
+
+  /* stages(): number of stages of the transform. */
+  constexpr std::size_t stages () const { return n_stages; }
+
+  /* valid(): whether the transform can be computed by the plan. */
+  constexpr bool valid () const {
+    std::size_t n = 1;
+    for (std::size_t s = 0; s < n_stages; s++)
+      n *= factors[s];
+
+    return n_points > 1 && n == n_points;
+  }
+
+  /* radix(): radix of the s'th stage. */
+  constexpr std::size_t radix (std::size_t s) const {
+    return factors[n_stages - 1 - s];
+  }
+
+  /* span(): length of the transforms combined in the s'th stage. */
+  constexpr std::size_t span (std::size_t s) const {
+    std::size_t m = 1;
+    for (std::size_t t = 0; t < s; t++)
+      m *= radix(t);
+
+    return m;
+  }
+
+  /* twiddle()
+   *
+   * Return the j'th twiddle factor 'phase shift' of the s'th stage,
+   * used to update the twiddle factors via trigonometric recurrences.
+   */
+  template<typename Type, std::size_t Dim>
+  constexpr Type twiddle (hx::fft::direction dir, std::size_t s,
+                          std::size_t j) const {
+    using Scalar = hx::scalar<Dim>;
+    return Type{Scalar::R() * alpha[s][j]
+              - Scalar::I() * (double(dir) * beta[s][j])};
+  }
+
+  /* reverse()
+   *
+   * Return the position that the i'th input point is moved to
+   * before the first stage, i.e. its mixed-radix digit reversal.
+   */
+  constexpr std::size_t reverse (std::size_t i) const {
+    std::size_t pos = 0, n = n_points;
+    for (std::size_t s = 0; s < n_stages; s++) {
+      const std::size_t r = factors[s];
+      n /= r;
+      pos += (i % r) * n;
+      i /= r;
+    }
+
+    return pos;
+  }
+
+  /* swaps()
+   *
+   * Return the sequence of swap operations that moves every input
+   * point to its reversed position, or an empty sequence if the plan
+   * is not valid (reverse() is then not a permutation).
+   */
+  std::vector<std::array<std::size_t, 2>> swaps () const {
+    std::vector<std::array<std::size_t, 2>> sw;
+    if (!valid())
+      return sw;
+
+    std::vector<bool> done(n_points);
+
+    for (std::size_t i = 0; i < n_points; i++) {
+      if (done[i])
+        continue;
+
+      done[i] = true;
+      for (std::size_t j = reverse(i); j != i; j = reverse(j)) {
+        sw.push_back({i, j});
+        done[j] = true;
+      }
+    }
+
+    return sw;
+  }
+
+private:
+  /* Internal state:
+   *  @n_points: number of points of the transform.
+   *  @n_stages: number of stages of the transform.
+   *  @factors: radices of the decomposition, outermost first.
+   *  @alpha: twiddle recurrence coefficients, 2 sin^2(pi j / len).
+   *  @beta: twiddle recurrence coefficients, sin(2 pi j / len).
+   */
+  std::size_t n_points;
+  std::size_t n_stages;
+  std::size_t factors[max_stages];
+  double alpha[max_stages][max_radix];
+  double beta[max_stages][max_radix];
+};
+
+/* namespace hx::fft */ }
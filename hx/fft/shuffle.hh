@@ -12,8 +12,6 @@ namespace hx::fft {
  * Constexpr-compatible class encoding the set of swap operations
  * required to transpose an N1-by-N2 matrix into an N2-by-N1
  * matrix in-place, i.e. to move from column-major to row-major.
- *
- * Used by general stages of hx::fft::block to shuffle indices.
  */
 template<typename Type, std::size_t N1, std::size_t N2, std::size_t Stride>
 class shuffle {
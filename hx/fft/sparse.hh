@@ -0,0 +1,196 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+namespace hx::fft {
+
+/* hx::fft::sparse<Array,Dir>
+ *
+ * Direct evaluation of the multidimensional Fourier sum of an array at
+ * a list of arbitrary (possibly fractional) frequency coordinates:
+ *
+ *   X(f) = sum_n x[n] prod_d exp(Dir * I_{d+1} * 2 pi f_d n_d / N_d)
+ *
+ * where f_d is measured in bins of dimension d, so integer coordinates
+ * reproduce points of the full transform.
+ *
+ * The sum is separable, and is contracted one dimension at a time
+ * by Horner's rule. Points are sorted by their coordinates, so that
+ * every run of points sharing a prefix of coordinates also shares the
+ * contractions of those dimensions. Groups of points with a common
+ * first coordinate are distributed over a set of threads.
+ */
+template<typename Array, hx::fft::direction Dir = hx::fft::fwd>
+class sparse {
+public:
+  /* Type: element type of the array.
+   * point: frequency coordinates of a single evaluation point.
+   */
+  using Type = typename Array::base_type;
+  using point = std::array<double, Array::ndims>;
+
+  /* sparse()
+   *
+   * Constructor taking the number of threads used for evaluation.
+   */
+  sparse (std::size_t threads = std::thread::hardware_concurrency())
+   : nthreads(threads > 0 ? threads : 1) {}
+
+  /* operator()()
+   *
+   * Evaluate the Fourier sum of an array at each of a list of points.
+   */
+  std::vector<Type> operator() (const Array& x,
+                                const std::vector<point>& pts) const {
+    std::vector<Type> out(pts.size());
+
+    /* sort the points into groups that share a first coordinate. */
+    std::vector<std::size_t> order(pts.size());
+    for (std::size_t i = 0; i < order.size(); i++)
+      order[i] = i;
+
+    std::sort(order.begin(), order.end(),
+      [&pts] (std::size_t a, std::size_t b) {
+        return pts[a] < pts[b];
+      });
+
+    std::vector<std::size_t> groups;
+    for (std::size_t i = 0; i < order.size(); i++)
+      if (i == 0 || pts[order[i]][0] != pts[order[i - 1]][0])
+        groups.push_back(i);
+
+    groups.push_back(order.size());
+
+    /* evaluate the groups on a set of worker threads. */
+    std::atomic<std::size_t> next{0};
+    auto work = [&] () {
+      std::vector<std::vector<Type>> bufs(Array::ndims);
+      for (std::size_t d = 0; d < Array::ndims; d++)
+        bufs[d].resize(tail[d]);
+
+      for (std::size_t g = next++; g + 1 < groups.size(); g = next++)
+        descend(0, x.raw_data(), groups[g], groups[g + 1],
+                pts, order, out, bufs);
+    };
+
+    const std::size_t nt = std::min(nthreads, groups.size() - 1);
+    std::vector<std::thread> pool;
+    for (std::size_t t = 1; t < nt; t++)
+      pool.emplace_back(work);
+
+    work();
+    for (auto& t : pool)
+      t.join();
+
+    return out;
+  }
+
+private:
+  /* shapes(): sizes of all dimensions of the array. */
+  template<std::size_t... Is>
+  static constexpr std::array<std::size_t, sizeof...(Is)>
+  shapes (std::index_sequence<Is...>) {
+    return {{ Array::template shape<Is>... }};
+  }
+
+  /* Array geometry:
+   *  @shape: sizes of all dimensions of the array.
+   *  @tail: number of elements in each slab of dimension d, i.e.
+   *   the product of the sizes of all dimensions after d.
+   */
+  static constexpr auto shape =
+    shapes(std::make_index_sequence<Array::ndims>());
+
+  static constexpr auto tail = [] {
+    std::array<std::size_t, Array::ndims> t{};
+    for (std::size_t d = Array::ndims, n = 1; d > 0; n *= shape[d - 1], d--)
+      t[d - 1] = n;
+
+    return t;
+  }();
+
+  /* Internal state:
+   *  @nthreads: number of threads used for evaluation.
+   */
+  std::size_t nthreads;
+
+  /* phase()
+   *
+   * Return exp(Dir * I_{d+1} * 2 pi f / N_d) as a Type.
+   */
+  template<std::size_t... Ds>
+  static Type phase (std::size_t d, double f, std::index_sequence<Ds...>) {
+    const double theta = 2 * hx::pi * f / double(shape[d]);
+    const double c = std::cos(theta), s = double(Dir) * std::sin(theta);
+
+    Type w;
+    ((d == Ds ? (w = Type{hx::scalar<Ds + 1>::R() * c
+                        + hx::scalar<Ds + 1>::I() * s}, 0) : 0), ...);
+
+    return w;
+  }
+
+  /* contract()
+   *
+   * Sum the outermost dimension (d) of a block of data at @src into
+   * the @n elements of each of its slabs at @dst, weighting the k'th
+   * slab by the k'th power of the phase of frequency f.
+   */
+  static void contract (std::size_t d, double f, const Type* src,
+                        Type* dst, std::size_t n) {
+    const Type w = phase(d, f, std::make_index_sequence<Array::ndims>());
+    const std::size_t N = shape[d];
+
+    for (std::size_t j = 0; j < n; j++)
+      dst[j] = src[(N - 1) * n + j];
+
+    for (std::size_t k = N - 1; k > 0; k--) {
+      const Type* row = src + (k - 1) * n;
+      for (std::size_t j = 0; j < n; j++)
+        dst[j] = dst[j] * w + row[j];
+    }
+  }
+
+  /* descend()
+   *
+   * Contract dimension d of the block of data at @src once for each
+   * run of the sorted points order[i0, i1) that share coordinate d,
+   * and descend into the remaining dimensions with the result. The
+   * contraction of dimension d is held in @bufs[d] until its run of
+   * points has been evaluated.
+   */
+  static void descend (std::size_t d, const Type* src,
+                       std::size_t i0, std::size_t i1,
+                       const std::vector<point>& pts,
+                       const std::vector<std::size_t>& order,
+                       std::vector<Type>& out,
+                       std::vector<std::vector<Type>>& bufs) {
+    for (std::size_t i = i0, j = i0; i < i1; i = j) {
+      const double f = pts[order[i]][d];
+      while (j < i1 && pts[order[j]][d] == f)
+        j++;
+
+      Type* dst = bufs[d].data();
+      contract(d, f, src, dst, tail[d]);
+
+      if (d + 1 == Array::ndims) {
+        for (std::size_t k = i; k < j; k++)
+          out[order[k]] = dst[0];
+      }
+      else
+        descend(d + 1, dst, i, j, pts, order, out, bufs);
+    }
+  }
+};
+
+/* namespace hx::fft */ }
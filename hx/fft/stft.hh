@@ -0,0 +1,150 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace hx::fft {
+
+/* hx::fft::stft<Type,N,Hop,Dim>
+ *
+ * Short-time Fourier transform of vectors of Type's, using windows of
+ * N points that start every Hop points (i.e. with N - Hop points of
+ * overlap between neighbouring windows). All frames are windowed into
+ * a single output array, and then transformed as one batch along the
+ * multicomplex unit Dim.
+ */
+template<typename Type, std::size_t N, std::size_t Hop, std::size_t Dim = 1>
+class stft {
+  static_assert(Hop > 0);
+
+public:
+  /* frames<L>
+   *
+   * Number of complete frames in a vector of L points.
+   */
+  template<std::size_t L>
+  static constexpr std::size_t frames = (L < N ? 0 : (L - N) / Hop + 1);
+
+  /* stft()
+   *
+   * Default constructor, uses a rectangular window.
+   */
+  stft () : win(N, 1.0) {}
+
+  /* stft(array)
+   *
+   * Constructor taking the window values.
+   */
+  stft (const hx::array<double, N>& w) : win(N) {
+    for (std::size_t n = 0; n < N; n++)
+      win[n] = w[n];
+  }
+
+  /* operator()()
+   *
+   * Compute the transforms of all frames of an L-point vector,
+   * returned as an array of frames<L> rows of N points.
+   */
+  template<std::size_t L>
+  auto operator() (const hx::array<Type, L>& x) const {
+    static_assert(frames<L> > 0);
+    using Out = hx::array<Type, frames<L>, N>;
+    auto y = std::make_unique<Out>();
+
+    (*this)(x, *y);
+    return y;
+  }
+
+  /* operator()()
+   *
+   * Compute the transforms of all frames of an L-point vector
+   * into an existing array of frames.
+   */
+  template<std::size_t L, std::size_t F>
+  void operator() (const hx::array<Type, L>& x,
+                   hx::array<Type, F, N>& y) const {
+    static_assert(F <= frames<L>);
+    const hx::fft::forward<Type, N, Dim> f;
+    Type* out = y.raw_data();
+
+    /* window all frames into the output array. */
+    for (std::size_t i = 0; i < F; i++)
+      for (std::size_t n = 0; n < N; n++)
+        out[i * N + n] = x[i * Hop + n] * win[n];
+
+    /* transform the batch of frames. */
+    for (std::size_t i = 0; i < F; i++)
+      f(out + i * N);
+  }
+
+private:
+  /* @win: window values applied to each frame. */
+  std::vector<double> win;
+};
+
+/* hx::fft::sdft<Type,N,Dim>
+ *
+ * Sliding discrete Fourier transform, which tracks a selected set of
+ * bins of the N-point forward transform of the most recent N samples
+ * of a stream. Each new sample updates every tracked bin in O(1).
+ */
+template<typename Type, std::size_t N, std::size_t Dim = 1>
+class sdft {
+public:
+  /* sdft(bins)
+   *
+   * Constructor taking the indices of the tracked bins.
+   */
+  sdft (std::vector<std::size_t> bins)
+   : ids(std::move(bins)), X(ids.size()), W(ids.size()), buf(N), pos(0) {
+    using Scalar = hx::scalar<Dim>;
+    for (std::size_t i = 0; i < ids.size(); i++)
+      W[i] = Type{Scalar::R() * hx::cos_pi(2 * ids[i], N)
+                + Scalar::I() * hx::sin_pi(2 * ids[i], N)};
+  }
+
+  /* push()
+   *
+   * Append a sample to the window, dropping the oldest sample,
+   * and update all tracked bins.
+   */
+  void push (const Type& x) {
+    const Type delta = x - buf[pos];
+    buf[pos] = x;
+    pos = (pos + 1) % N;
+
+    for (std::size_t i = 0; i < ids.size(); i++)
+      X[i] = (X[i] + delta) * W[i];
+  }
+
+  /* size(): number of tracked bins. */
+  std::size_t size () const { return ids.size(); }
+
+  /* bin(): index of the i'th tracked bin. */
+  std::size_t bin (std::size_t i) const { return ids[i]; }
+
+  /* operator[]()
+   *
+   * Return the current value of the i'th tracked bin.
+   */
+  const Type& operator[] (std::size_t i) const { return X[i]; }
+
+private:
+  /* Internal state:
+   *  @ids: indices of the tracked bins.
+   *  @X: current values of the tracked bins.
+   *  @W: per-sample phase shift of each tracked bin.
+   *  @buf: circular buffer of the most recent N samples.
+   *  @pos: position of the oldest sample in @buf.
+   */
+  std::vector<std::size_t> ids;
+  std::vector<Type> X, W, buf;
+  std::size_t pos;
+};
+
+/* namespace hx::fft */ }
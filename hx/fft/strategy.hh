@@ -0,0 +1,38 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::fft {
+
+/* hx::fft::strategy
+ *
+ * Enumeration of the ways a transform may be applied along
+ * one dimension of an array.
+ *  @automatic: select one of the below by size and stride.
+ *  @strided: transform each vector in-place at its stride.
+ *  @transposed: transpose panels of vectors into contiguous memory,
+ *               transform them at unit stride, and transpose back.
+ */
+enum strategy : int { automatic, strided, transposed };
+
+/* hx::fft::choose_strategy()
+ *
+ * Return the strategy for transforming @count vectors of @n elements
+ * of @bytes each, separated by @stride elements. Vectors at unit stride,
+ * or whose interleaved set fits within the last-level cache (assumed
+ * to hold hx::exec::llc_bytes), are transformed in place, and all
+ * others are transposed.
+ */
+constexpr hx::fft::strategy choose_strategy (std::size_t n,
+                                             std::size_t stride,
+                                             std::size_t bytes) {
+  if (stride == 1 || n * stride * bytes <= hx::exec::llc_bytes)
+    return hx::fft::strided;
+
+  return hx::fft::transposed;
+}
+
+/* namespace hx::fft */ }
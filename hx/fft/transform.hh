@@ -7,9 +7,41 @@
 
 namespace hx::fft {
 
+/* hx::fft::is_good_size()
+ *
+ * Return whether a transform length can be factored into
+ * the radices supported by hx::fft::block.
+ */
+constexpr bool is_good_size (std::size_t n) {
+  if (n < 2)
+    return false;
+
+  for (std::size_t f : {2, 3, 5})
+    while (n % f == 0)
+      n /= f;
+
+  return n == 1;
+}
+
+/* hx::fft::good_size()
+ *
+ * Return the smallest supported transform length
+ * that is no less than n.
+ */
+constexpr std::size_t good_size (std::size_t n) {
+  while (!is_good_size(n))
+    n++;
+
+  return n;
+}
+
 /* hx::fft::transform<Type,N,Dir,Dim>
  *
  * Base type for all fast discrete Fourier transforms.
+ *
+ * When Type is a reduced-precision storage type (e.g. hx::scalarf<K>),
+ * elements are loaded and stored at that precision, while all butterfly
+ * and twiddle arithmetic is carried out in hx::wide_type_t<Type>.
  */
 template<typename Type, std::size_t N,
          hx::fft::direction Dir,
@@ -21,13 +53,21 @@ public:
    * Apply an in-place transform to the provided data vector.
    */
   template<typename Ptr>
-  void operator() (Ptr x) const { blk(x); }
+  void operator() (Ptr x) const {
+    if constexpr (std::is_same_v<Type, Wide>)
+      blk(x);
+    else
+      blk(hx::fft::widen<Ptr, Wide>(x));
+  }
 
 private:
+  /* Wide: type used for arithmetic within the transform. */
+  using Wide = hx::wide_type_t<Type>;
+
   /* Computational block:
    *  @blk: Top-level block of the transform.
    */
-  hx::fft::block<Type, Dir, Dim, N, 1> blk;
+  hx::fft::block<Wide, Dir, Dim, N, 1> blk;
 };
 
 /* hx::fft::forward
@@ -0,0 +1,79 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::fft {
+
+/* hx::fft::widen<Ptr,Wide>
+ *
+ * Pointer-like adaptor that presents a vector of narrow (storage)
+ * elements as a vector of Wide elements. Reads through the adaptor
+ * widen the stored value, and writes round it back to storage.
+ *
+ * Used by hx::fft::transform to run the blocks of mixed-precision
+ * transforms in wide arithmetic, rounding once per pass.
+ */
+template<typename Ptr, typename Wide>
+class widen {
+public:
+  /* Store: type of the elements addressed by Ptr. */
+  using Store = std::remove_reference_t<
+                  decltype(std::declval<Ptr&>()[std::size_t{}])>;
+
+  /* reference
+   *
+   * Proxy returned by the subscripting operator of widen.
+   */
+  class reference {
+  public:
+    /* reference(Store&): constructor. */
+    constexpr reference (Store& s) : elem(s) {}
+
+    /* operator Wide(): load and widen the stored element. */
+    constexpr operator Wide () const { return Wide(elem); }
+
+    /* operator=(Wide): round and store a wide value. */
+    constexpr reference& operator= (const Wide& w) {
+      elem = Store(w);
+      return *this;
+    }
+
+    /* operator=(reference): copy a stored element without rounding. */
+    constexpr reference& operator= (const reference& r) {
+      elem = r.elem;
+      return *this;
+    }
+
+  private:
+    /* @elem: referenced storage element. */
+    Store& elem;
+  };
+
+  /* widen(Ptr): constructor. */
+  constexpr widen (Ptr p) : x(p) {}
+
+  /* operator[]()
+   *
+   * Subscripting operator. Returns a proxy to the @idx'th element.
+   */
+  constexpr reference operator[] (std::size_t idx) {
+    return reference(x[idx]);
+  }
+
+  /* operator+()
+   *
+   * Offset/re-addressing operator.
+   */
+  constexpr widen operator+ (std::size_t offset) const {
+    return widen(x + offset);
+  }
+
+private:
+  /* @x: wrapped pointer to storage elements. */
+  Ptr x;
+};
+
+/* namespace hx::fft */ }
@@ -446,6 +446,58 @@ public:
     }
   }
 
+  /* pack_tiled<Tile>()
+   *
+   * Compute the linear array offset from an index, where elements
+   * are stored in tiles of (at most) Tile elements along each
+   * dimension. Tiles are stored in right-first order, and so are
+   * the elements within each tile.
+   */
+  template<std::size_t Tile>
+  constexpr std::size_t pack_tiled () const {
+    std::size_t outer = 0, inner = 0, volume = 1;
+
+    for (std::size_t i = 0; i < n; i++) {
+      const std::size_t t = tile<Tile>(i);
+      outer = outer * (sz[i] / t) + ids[i] / t;
+      inner = inner * t + ids[i] % t;
+      volume *= t;
+    }
+
+    return outer * volume + inner;
+  }
+
+  /* unpack_tiled<Tile>()
+   *
+   * Reverse the process of pack_tiled(), computing the index values
+   * from a tiled linear array offset.
+   */
+  template<std::size_t Tile>
+  constexpr void unpack_tiled (std::size_t offset) {
+    std::size_t volume = 1;
+    for (std::size_t i = 0; i < n; i++)
+      volume *= tile<Tile>(i);
+
+    std::size_t outer = offset / volume, inner = offset % volume;
+    for (std::size_t i = n; i > 0; i--) {
+      const std::size_t t = tile<Tile>(i - 1);
+      const std::size_t m = sz[i - 1] / t;
+      ids[i - 1] = (outer % m) * t + inner % t;
+      outer /= m;
+      inner /= t;
+    }
+  }
+
+  /* tile<Tile>()
+   *
+   * Return the extent of tiles of (at most) Tile elements along
+   * dimension @i.
+   */
+  template<std::size_t Tile>
+  static constexpr std::size_t tile (std::size_t i) {
+    return (Tile < sz[i] ? Tile : sz[i]);
+  }
+
   /* size<i>()
    *
    * Return the template size at index @i from an hx::index type.
@@ -0,0 +1,212 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace hx::map {
+
+/* hx::map::mode
+ *
+ * Enumeration of the ways in which a file may be mapped:
+ *  @read_only: elements may only be read.
+ *  @read_write: writes to elements are stored in the file.
+ *  @copy_on_write: writes to elements are private to the mapping,
+ *   and are never stored in the file.
+ */
+enum mode : int { read_only, read_write, copy_on_write };
+
+/* hx::map::advice
+ *
+ * Enumeration of the expected access patterns of a mapping,
+ * passed to the kernel as madvise() hints.
+ */
+enum advice : int { normal, sequential, random, willneed, dontneed };
+
+/* namespace hx::map */ }
+
+namespace hx {
+
+/* hx::mapped_array<Type, Dims...>
+ *
+ * File-backed storage of an hx::array. The array elements are an
+ * mmap() of a raw file in the in-memory layout of the array, after
+ * an optional header of a fixed number of bytes. The mapped array
+ * is accessed through operator*() and operator->(), and may be
+ * used wherever an hx::array is accepted by reference, or through
+ * ptr() wherever a unique pointer to an array is accepted.
+ *
+ * Mappings of a const Type are read-only, and only expose a const
+ * array. Mappings of a non-const Type must be writable.
+ */
+template<typename Type, std::size_t... Dims>
+class mapped_array {
+public:
+  /* Type information:
+   *   array_type: type of the mapped array.
+   *   element_type: array_type, const-qualified for read-only
+   *    mappings.
+   *   pointer_type: owning pointer to the mapped array, which
+   *    unmaps the file when destroyed.
+   */
+  using array_type = hx::array<std::remove_const_t<Type>, Dims...>;
+  using element_type = std::conditional_t<std::is_const_v<Type>,
+                                          const array_type, array_type>;
+  using pointer_type = std::unique_ptr<element_type, hx::alloc::deleter>;
+
+  /* @default_mode: mode of mappings opened without one. */
+  static constexpr hx::map::mode default_mode =
+    std::is_const_v<Type> ? hx::map::read_only : hx::map::copy_on_write;
+
+  /* mapped_array(): default constructor. */
+  mapped_array () {}
+
+  /* mapped_array(const char*, ...)
+   *
+   * Constructor that opens and maps a file. Check is_open()
+   * for success.
+   */
+  mapped_array (const char* path, hx::map::mode m = default_mode,
+                std::size_t header = 0) {
+    open(path, m, header);
+  }
+
+  /* delete the copy constructor. */
+  mapped_array (const mapped_array& other) = delete;
+
+  /* mapped_array(mapped_array&&): move constructor. */
+  mapped_array (mapped_array&& other) = default;
+
+  /* open(const char*)
+   *
+   * Map the file at @path, whose array elements start @header bytes
+   * into the file. Read-write mappings create the file if needed,
+   * and extend it to hold the full array. Returns false, leaving no
+   * file mapped, if the file could not be opened, mapped or closed.
+   */
+  bool open (const char* path, hx::map::mode m = default_mode,
+             std::size_t header = 0) {
+    const int flags = (m == hx::map::read_write ? O_RDWR | O_CREAT
+                                                : O_RDONLY);
+
+    const int fd = ::open(path, flags, 0644);
+    if (fd < 0)
+      return false;
+
+    const bool ok = open(fd, m, header);
+    if (::close(fd) != 0) {
+      close();
+      return false;
+    }
+
+    return ok;
+  }
+
+  /* open(int)
+   *
+   * Map the file referenced by the descriptor @fd, which may be
+   * closed once open() returns. Read-only mappings may only be
+   * opened for a const Type, and writable ones for a non-const Type.
+   */
+  bool open (int fd, hx::map::mode m = default_mode,
+             std::size_t header = 0) {
+    close();
+    if ((m == hx::map::read_only) != std::is_const_v<Type>)
+      return false;
+
+    if (header % alignof(array_type) != 0)
+      return false;
+
+    struct stat st;
+    const std::size_t n = header + sizeof(array_type);
+    if (::fstat(fd, &st) != 0)
+      return false;
+
+    if (std::size_t(st.st_size) < n) {
+      if (m != hx::map::read_write || ::ftruncate(fd, n) != 0)
+        return false;
+    }
+
+    const int prot = (m == hx::map::read_only ? PROT_READ
+                                              : PROT_READ | PROT_WRITE);
+    const int share = (m == hx::map::read_write ? MAP_SHARED
+                                                : MAP_PRIVATE);
+
+    void* ptr = ::mmap(nullptr, n, prot, share, fd, 0);
+    if (ptr == MAP_FAILED)
+      return false;
+
+    auto x = reinterpret_cast<array_type*>(static_cast<char*>(ptr) + header);
+    arr = pointer_type(x, hx::alloc::deleter{ptr, n});
+    return true;
+  }
+
+  /* advise()
+   *
+   * Pass an access pattern hint for the mapped array to the kernel.
+   */
+  bool advise (hx::map::advice a) const {
+    constexpr int hints[] = {
+      MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM,
+      MADV_WILLNEED, MADV_DONTNEED
+    };
+
+    const auto& d = arr.get_deleter();
+    return arr && ::madvise(d.base, d.len, hints[a]) == 0;
+  }
+
+  /* sync()
+   *
+   * Write all modified elements of a read-write mapping to the file,
+   * returning once the write has completed.
+   */
+  bool sync () const {
+    const auto& d = arr.get_deleter();
+    return arr && ::msync(d.base, d.len, MS_SYNC) == 0;
+  }
+
+  /* close(): unmap the file. */
+  void close () { arr.reset(); }
+
+  /* is_open(): whether a file is mapped. */
+  bool is_open () const { return arr != nullptr; }
+
+  /* ptr()
+   *
+   * Return the owning pointer to the mapped array, e.g. for use as
+   * the source of an hx::proc::node. The mapping stays owned by the
+   * mapped_array.
+   */
+  const pointer_type& ptr () const { return arr; }
+
+  /* release(): transfer ownership of the mapping to the caller. */
+  pointer_type release () { return std::move(arr); }
+
+  /* get(): pointer to the mapped array. */
+  element_type* get () { return arr.get(); }
+  const array_type* get () const { return arr.get(); }
+
+  /* operator*(), operator->(): access the mapped array. */
+  element_type& operator* () { return *arr; }
+  const array_type& operator* () const { return *arr; }
+  element_type* operator-> () { return arr.get(); }
+  const array_type* operator-> () const { return arr.get(); }
+
+private:
+  /* Internal state:
+   *  @arr: mapped array elements, owning the whole mapping
+   *   (including the header) through its deleter.
+   */
+  pointer_type arr;
+};
+
+/* namespace hx */ }
@@ -0,0 +1,182 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <utility>
+
+#include "scalar.hh"
+
+namespace hx {
+
+/* squaredNorm()
+ *
+ * Return the sum of squares of the coefficients of a value.
+ */
+inline constexpr double squaredNorm (double x) {
+  return x * x;
+}
+
+/* squaredNorm(scalar) */
+template<std::size_t Dim>
+inline constexpr double squaredNorm (const hx::scalar<Dim>& x) {
+  return x.squaredNorm();
+}
+
+/* norm()
+ *
+ * Return the norm of a value, the square root of its sum of squares.
+ */
+inline double norm (double x) {
+  return std::abs(x);
+}
+
+/* norm(scalar) */
+template<std::size_t Dim>
+inline double norm (const hx::scalar<Dim>& x) {
+  return x.norm();
+}
+
+/* abs()
+ *
+ * Return the absolute value of a real number, or the norm
+ * of a multicomplex number.
+ */
+inline double abs (double x) {
+  return std::abs(x);
+}
+
+/* abs(scalar) */
+template<std::size_t Dim>
+inline double abs (const hx::scalar<Dim>& x) {
+  return x.norm();
+}
+
+/* conj()
+ *
+ * Return a value with only the multicomplex unit u negated.
+ */
+inline constexpr double conj (double x, std::size_t u) {
+  return x;
+}
+
+/* conj(scalar) */
+template<std::size_t Dim>
+inline constexpr hx::scalar<Dim> conj (const hx::scalar<Dim>& x,
+                                       std::size_t u) {
+  if constexpr (Dim == 0)
+    return x;
+  else if (u == Dim)
+    return {x.real, -x.imag};
+  else
+    return {hx::conj(x.real, u), hx::conj(x.imag, u)};
+}
+
+/* exp()
+ *
+ * Return the exponential of a real number.
+ */
+inline double exp (double x) {
+  return std::exp(x);
+}
+
+/* exp(scalar): declared here for use by cis(), below. */
+template<std::size_t Dim>
+inline hx::scalar<Dim> exp (const hx::scalar<Dim>& x);
+
+/* cis()
+ *
+ * Return the pair (cos(x), sin(x)) of a multicomplex number.
+ * Using the unit I of x = a + I b, where a and b commute with I:
+ *
+ *   cos(x) = cos(a) cosh(b) - I sin(a) sinh(b)
+ *   sin(x) = sin(a) cosh(b) + I cos(a) sinh(b)
+ */
+template<std::size_t Dim>
+inline std::pair<hx::scalar<Dim>, hx::scalar<Dim>>
+cis (const hx::scalar<Dim>& x) {
+  if constexpr (Dim == 0) {
+    return {std::cos(x.real), std::sin(x.real)};
+  }
+  else {
+    const auto [ca, sa] = hx::cis(x.real);
+    const auto ep = hx::exp(x.imag);
+    const auto em = hx::exp(-x.imag);
+    const auto ch = (ep + em) * 0.5;
+    const auto sh = (ep - em) * 0.5;
+    return {{ca * ch, -(sa * sh)}, {sa * ch, ca * sh}};
+  }
+}
+
+/* exp(scalar)
+ *
+ * Return the exponential of a multicomplex number x = a + I b:
+ *
+ *   exp(x) = exp(a) (cos(b) + I sin(b))
+ */
+template<std::size_t Dim>
+inline hx::scalar<Dim> exp (const hx::scalar<Dim>& x) {
+  if constexpr (Dim == 0) {
+    return std::exp(x.real);
+  }
+  else {
+    const auto r = hx::exp(x.real);
+    const auto [c, s] = hx::cis(x.imag);
+    return {r * c, r * s};
+  }
+}
+
+/* sqrt()
+ *
+ * Return the square root of a real number.
+ */
+inline double sqrt (double x) {
+  return std::sqrt(x);
+}
+
+/* sqrt(scalar)
+ *
+ * Return the principal square root of a multicomplex number
+ * x = a + I b, computed from the root w of (a^2 + b^2) as:
+ *
+ *   sqrt(x) = r + I b / (2 r),  r = sqrt((w + a) / 2)
+ *
+ * or as I sqrt(-a) when r vanishes.
+ */
+template<std::size_t Dim>
+inline hx::scalar<Dim> sqrt (const hx::scalar<Dim>& x) {
+  if constexpr (Dim == 0) {
+    return std::sqrt(x.real);
+  }
+  else {
+    const auto w = hx::sqrt(x.real * x.real + x.imag * x.imag);
+    const auto r = hx::sqrt((w + x.real) * 0.5);
+    if (r.squaredNorm() == 0)
+      return {r, hx::sqrt(-x.real)};
+
+    return {r, x.imag * (r * 2.0).inverse()};
+  }
+}
+
+/* soft_threshold()
+ *
+ * Shrink the norm of a value towards zero by t, or return zero
+ * when the norm does not exceed t.
+ */
+inline double soft_threshold (double x, double t) {
+  const double n = std::abs(x);
+  return x * (n > t ? 1 - t / n : 0);
+}
+
+/* soft_threshold(scalar) */
+template<std::size_t Dim>
+inline hx::scalar<Dim> soft_threshold (const hx::scalar<Dim>& x,
+                                       double t) {
+  const double n = x.norm();
+  return x * (n > t ? 1 - t / n : 0);
+}
+
+/* namespace hx */ }
@@ -6,6 +6,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace hx {
 
@@ -68,7 +70,111 @@ public:
     return xdata[Stride1 * i + Stride2 * j];
   }
 
+  /* is_operand<T>
+   *
+   * Struct template for checking if a type is accepted by the compound
+   * assignment operators: a non-indexable value, or a matrix view of
+   * the same shape.
+   */
+  template<typename T>
+  struct is_operand
+   : std::bool_constant<!hx::op::is_indexable_v<T>> {};
+
+  template<typename A, std::size_t D1, std::size_t D2>
+  struct is_operand<hx::matrix<A, D1, D2, Rows, Cols>> : std::true_type {};
+
+  /* operator+=()
+   *
+   * Compound addition operator from scalar values and matrix views
+   * of equal shape. When the operand shares elements with this view
+   * at different positions (e.g. its transpose), it is read in full
+   * before any writes.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  matrix& operator+= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  matrix& operator-= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  matrix& operator*= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  matrix& operator/= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x /= y; });
+  }
+
+  /* data(): pointer to the first viewed element. */
+  constexpr base_type* data () const { return xdata; }
+
+  /* stride<d>(): in-memory spacing between viewed elements along
+   * the rows (d = 0) or columns (d = 1) of the matrix.
+   */
+  template<std::size_t d>
+  static constexpr std::size_t stride () { return d == 0 ? Stride1 : Stride2; }
+
 private:
+  /* update()
+   *
+   * Implementation of the compound assignment operators.
+   */
+  template<typename T, typename Op>
+  matrix& update (const T& rhs, const Op& op) {
+    if constexpr (hx::op::is_indexable_v<T>) {
+      if (overlaps(rhs.data(), T::template stride<0>(),
+                   T::template stride<1>())) {
+        std::vector<typename T::base_type> tmp(Rows * Cols);
+        for (std::size_t i = 0; i < Rows; i++)
+          for (std::size_t j = 0; j < Cols; j++)
+            tmp[i * Cols + j] = rhs(i,j);
+
+        for (std::size_t i = 0; i < Rows; i++)
+          for (std::size_t j = 0; j < Cols; j++)
+            op((*this)(i,j), tmp[i * Cols + j]);
+      }
+      else {
+        for (std::size_t i = 0; i < Rows; i++)
+          for (std::size_t j = 0; j < Cols; j++)
+            op((*this)(i,j), rhs(i,j));
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < Rows; i++)
+        for (std::size_t j = 0; j < Cols; j++)
+          op((*this)(i,j), rhs);
+    }
+    return *this;
+  }
+
+  /* overlaps()
+   *
+   * Check whether a Rows-by-Cols view at @ptr spaced by @step1 and
+   * @step2 shares memory with this view, other than by being identical.
+   */
+  template<typename T>
+  bool overlaps (const T* ptr, std::size_t step1, std::size_t step2) const {
+    const auto a0 = reinterpret_cast<std::uintptr_t>(xdata);
+    const auto b0 = reinterpret_cast<std::uintptr_t>(ptr);
+    if (a0 == b0 && step1 * sizeof(T) == Stride1 * sizeof(base_type) &&
+                    step2 * sizeof(T) == Stride2 * sizeof(base_type))
+      return false;
+
+    const std::size_t na = (Rows - 1) * Stride1 + (Cols - 1) * Stride2 + 1;
+    const std::size_t nb = (Rows - 1) * step1 + (Cols - 1) * step2 + 1;
+    const auto a1 = a0 + na * sizeof(base_type);
+    const auto b1 = b0 + nb * sizeof(T);
+    return a0 < b1 && b0 < a1;
+  }
+
   /* Static data members:
    *  @Stride1: in-memory spacing between viewed first-dimension elements.
    *  @Stride2: in-memory spacing between viewed second-dimension elements.
@@ -10,6 +10,28 @@
 
 namespace hx::op {
 
+/* hx::op::apply<type>(x, y)
+ *
+ * Evaluate a binary operation on a pair of element values.
+ */
+template<hx::op::type type, typename A, typename B>
+inline constexpr auto apply (const A& x, const B& y) {
+  if constexpr (type == hx::op::plus)
+    return x + y;
+  else if constexpr (type == hx::op::minus)
+    return x - y;
+  else if constexpr (type == hx::op::times)
+    return x * y;
+  else if constexpr (type == hx::op::divide)
+    return x / y;
+  else if constexpr (type == hx::op::conjugate)
+    return hx::conj(x, y);
+  else if constexpr (type == hx::op::threshold)
+    return hx::soft_threshold(x, y);
+  else
+    return x;
+}
+
 /* hx::op::binary<type, Ta, Tb, IdxA, IdxB>
  *
  * Struct for encapsulating binary array operations.
@@ -31,16 +53,11 @@ struct binary<type, Ta, Tb, true, true> {
   constexpr binary (Ta lhs, Tb rhs) : a(lhs), b(rhs) {}
 
   inline constexpr auto operator[] (const index_type& idx) const {
-    if constexpr (type == hx::op::plus)
-      return a[idx] + b[idx];
-    else if constexpr (type == hx::op::minus)
-      return a[idx] - b[idx];
-    else if constexpr (type == hx::op::times)
-      return a[idx] * b[idx];
-    else if constexpr (type == hx::op::divide)
-      return a[idx] / b[idx];
-    else
-      return a[idx];
+    return hx::op::apply<type>(a[idx], b[idx]);
+  }
+
+  inline constexpr auto at (std::size_t i) const {
+    return hx::op::apply<type>(hx::op::flat(a, i), hx::op::flat(b, i));
   }
 
   Ta a;
@@ -59,16 +76,11 @@ struct binary<type, Ta, Tb, true, false> {
   constexpr binary (Ta lhs, Tb rhs) : a(lhs), b(rhs) {}
 
   inline constexpr auto operator[] (const index_type& idx) const {
-    if constexpr (type == hx::op::plus)
-      return a[idx] + b;
-    else if constexpr (type == hx::op::minus)
-      return a[idx] - b;
-    else if constexpr (type == hx::op::times)
-      return a[idx] * b;
-    else if constexpr (type == hx::op::divide)
-      return a[idx] / b;
-    else
-      return a[idx];
+    return hx::op::apply<type>(a[idx], b);
+  }
+
+  inline constexpr auto at (std::size_t i) const {
+    return hx::op::apply<type>(hx::op::flat(a, i), b);
   }
 
   Ta a;
@@ -87,21 +99,24 @@ struct binary<type, Ta, Tb, false, true> {
   constexpr binary (Ta lhs, Tb rhs) : a(lhs), b(rhs) {}
 
   inline constexpr auto operator[] (const index_type& idx) const {
-    if constexpr (type == hx::op::plus)
-      return a + b[idx];
-    else if constexpr (type == hx::op::minus)
-      return a - b[idx];
-    else if constexpr (type == hx::op::times)
-      return a * b[idx];
-    else if constexpr (type == hx::op::divide)
-      return a / b[idx];
-    else
-      return a;
+    return hx::op::apply<type>(a, b[idx]);
+  }
+
+  inline constexpr auto at (std::size_t i) const {
+    return hx::op::apply<type>(a, hx::op::flat(b, i));
   }
 
   Ta a;
   Tb b;
 };
 
+/* is_flat<binary<type, Ta, Tb>>
+ *
+ * Binary expressions are flat when both of their operands are flat.
+ */
+template<hx::op::type type, typename Ta, typename Tb>
+struct is_flat<hx::op::binary<type, Ta, Tb>>
+ : std::bool_constant<hx::op::is_flat_v<Ta> && hx::op::is_flat_v<Tb>> {};
+
 /* namespace hx::op */ }
 
@@ -0,0 +1,50 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include "unary.hh"
+#include "binary.hh"
+
+namespace hx::op {
+
+/* declarations of the recursive overloads of all_leaves(). */
+template<hx::op::type type, typename T, typename Pred>
+inline constexpr bool all_leaves (const hx::op::unary<type, T>& x,
+                                  const Pred& pred);
+
+template<hx::op::type type, typename Ta, typename Tb, typename Pred>
+inline constexpr bool all_leaves (const hx::op::binary<type, Ta, Tb>& x,
+                                  const Pred& pred);
+
+/* all_leaves()
+ *
+ * Check a predicate on every indexable operand (leaf) of an array
+ * expression, returning true if it holds for all of them. Values
+ * are not passed to the predicate.
+ */
+template<typename T, typename Pred>
+inline constexpr bool all_leaves (const T& x, const Pred& pred) {
+  if constexpr (!hx::op::is_indexable_v<T>)
+    return true;
+  else
+    return pred(x);
+}
+
+/* all_leaves(unary) */
+template<hx::op::type type, typename T, typename Pred>
+inline constexpr bool all_leaves (const hx::op::unary<type, T>& x,
+                                  const Pred& pred) {
+  return hx::op::all_leaves(x.a, pred);
+}
+
+/* all_leaves(binary) */
+template<hx::op::type type, typename Ta, typename Tb, typename Pred>
+inline constexpr bool all_leaves (const hx::op::binary<type, Ta, Tb>& x,
+                                  const Pred& pred) {
+  return hx::op::all_leaves(x.a, pred) && hx::op::all_leaves(x.b, pred);
+}
+
+/* namespace hx::op */ }
@@ -9,7 +9,16 @@
 
 namespace hx::op {
 
-enum type : std::size_t { plus, minus, times, divide, conjugate };
+/* hx::op::type
+ *
+ * Enumeration of the operations held by array expressions. The
+ * conjugate type negates all units of a unary expression, or only
+ * the unit given by the second operand of a binary expression.
+ */
+enum type : std::size_t {
+  plus, minus, times, divide, conjugate,
+  norm, squared_norm, abs, exp, sqrt, threshold
+};
 
 /* namespace hx::op */ }
 
@@ -10,6 +10,30 @@
 
 namespace hx::op {
 
+/* hx::op::apply<type>(x)
+ *
+ * Evaluate a unary operation on a single element value.
+ */
+template<hx::op::type type, typename A>
+inline constexpr auto apply (const A& x) {
+  if constexpr (type == hx::op::conjugate)
+    return ~x;
+  else if constexpr (type == hx::op::minus)
+    return -x;
+  else if constexpr (type == hx::op::norm)
+    return hx::norm(x);
+  else if constexpr (type == hx::op::squared_norm)
+    return hx::squaredNorm(x);
+  else if constexpr (type == hx::op::abs)
+    return hx::abs(x);
+  else if constexpr (type == hx::op::exp)
+    return hx::exp(x);
+  else if constexpr (type == hx::op::sqrt)
+    return hx::sqrt(x);
+  else
+    return x;
+}
+
 /* hx::op::unary<type, T>
  *
  * Struct for encapsulating unary array operations.
@@ -21,16 +45,23 @@ struct unary {
   constexpr unary (T operand) : a(operand) {}
 
   inline constexpr auto operator[] (const index_type& idx) const {
-    if constexpr (type == hx::op::conjugate)
-      return ~a[idx];
-    else if constexpr (type == hx::op::minus)
-      return -a[idx];
-    else
-      return a[idx];
+    return hx::op::apply<type>(a[idx]);
+  }
+
+  inline constexpr auto at (std::size_t i) const {
+    return hx::op::apply<type>(hx::op::flat(a, i));
   }
 
   T a;
 };
 
+/* is_flat<unary<type, T>>
+ *
+ * Unary expressions are flat when their operand is flat.
+ */
+template<hx::op::type type, typename T>
+struct is_flat<hx::op::unary<type, T>>
+ : std::bool_constant<hx::op::is_flat_v<T>> {};
+
 /* namespace hx::op */ }
 
@@ -38,6 +38,21 @@ struct is_indexable<T, std::void_t<hx::op::index_type<T>>>
 template<typename T>
 inline constexpr bool is_indexable_v = is_indexable<T>::value;
 
+/* has_index<T, Idx>
+ *
+ * Struct template for checking if a type defines a specific index type.
+ */
+template<typename T, typename Idx, typename = void>
+struct has_index : std::false_type {};
+/**/
+template<typename T, typename Idx>
+struct has_index<T, Idx,
+  std::enable_if_t<std::is_same_v<hx::op::index_type<T>, Idx>>>
+ : std::true_type {};
+/**/
+template<typename T, typename Idx>
+inline constexpr bool has_index_v = has_index<T, Idx>::value;
+
 /* is_subscriptable<T, Idx>
  *
  * Struct template for checking if a type can be subscripted
@@ -53,5 +68,51 @@ struct is_subscriptable<T, Idx, std::void_t<hx::op::index_result<T, Idx>>>
 template<typename T, typename Idx>
 inline constexpr bool is_subscriptable_v = is_subscriptable<T, Idx>::value;
 
+/* has_raw_data<T>
+ *
+ * Struct template for checking if a type exposes its elements as
+ * a contiguous block of memory through raw_data().
+ */
+template<typename T, typename = void>
+struct has_raw_data : std::false_type {};
+/**/
+template<typename T>
+struct has_raw_data<T,
+  std::void_t<decltype(std::declval<const std::remove_reference_t<T>&>()
+                         .raw_data())>>
+ : std::true_type {};
+/**/
+template<typename T>
+inline constexpr bool has_raw_data_v = has_raw_data<T>::value;
+
+/* is_flat<T>
+ *
+ * Struct template for checking if an expression operand may be
+ * evaluated at linear element offsets, i.e. if it is a contiguous
+ * array, a non-indexable value, or an expression of such operands.
+ * Specialized for expressions in unary.hh and binary.hh.
+ */
+template<typename T, typename = void>
+struct is_flat
+ : std::bool_constant<!hx::op::is_indexable_v<T> ||
+                      hx::op::has_raw_data_v<T>> {};
+/**/
+template<typename T>
+inline constexpr bool is_flat_v = is_flat<std::remove_reference_t<T>>::value;
+
+/* flat()
+ *
+ * Return the element of an expression operand at a linear offset.
+ */
+template<typename T>
+inline constexpr auto flat (const T& x, std::size_t i) {
+  if constexpr (hx::op::has_raw_data_v<T>)
+    return x.raw_data()[i];
+  else if constexpr (hx::op::is_indexable_v<T>)
+    return x.at(i);
+  else
+    return x;
+}
+
 /* namespace hx::op */ }
 
@@ -0,0 +1,333 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace hx {
+
+/* hx::planar<Dim, Dims...>
+ *
+ * Multidimensional array of hx::scalar<Dim>'s stored in planar
+ * (structure-of-arrays) layout: each of the 2^Dim coefficients of
+ * every element is held in its own contiguous plane, which is laid
+ * out like an hx::array<double, Dims...>. Elements are accessed
+ * through proxies, and the planes themselves are zero-copy arrays.
+ * Vector kernels (e.g. Fourier transforms) run on copies of each
+ * vector gathered from the planes, and processing nodes convert
+ * planar inputs into interleaved arrays before transforming them.
+ * Zero-filling planar inputs is not supported.
+ */
+template<std::size_t Dim, std::size_t... Dims>
+class planar {
+public:
+  /* Static properties:
+   *  @size: number of array elements.
+   *  @ndims: number of array dimensions.
+   *  @planes: number of coefficient planes.
+   */
+  static constexpr std::size_t size = (Dims * ...);
+  static constexpr std::size_t ndims = sizeof...(Dims);
+  static constexpr std::size_t planes = std::size_t(1) << Dim;
+
+  /* Type information:
+   *   base_type: type of each array element.
+   *   plane_type: array type of each coefficient plane.
+   *   index_type: type of accepted indices to operator[].
+   */
+  using base_type = hx::scalar<Dim>;
+  using plane_type = hx::array<double, Dims...>;
+  using index_type = typename plane_type::index_type;
+
+  /* shape<dim>: size of each array dimension. */
+  template<std::size_t dim, typename = std::enable_if_t<(dim < ndims)>>
+  static inline constexpr auto shape = index_type::template size<dim>();
+
+  /* reference
+   *
+   * Proxy returned by the non-const subscripting operator, which
+   * gathers and scatters the coefficients of an element.
+   */
+  class reference {
+  public:
+    /* reference(): constructor. */
+    reference (planar& a, std::size_t i) : arr(a), off(i) {}
+
+    /* operator base_type(): gather the element. */
+    operator base_type () const { return arr.at(off); }
+
+    /* operator=(base_type): scatter the element. */
+    reference& operator= (const base_type& x) {
+      arr.store(off, x);
+      return *this;
+    }
+
+    /* operator=(reference): copy an element. */
+    reference& operator= (const reference& r) {
+      return *this = base_type(r);
+    }
+
+    /* operator[](): reference a coefficient within its plane. */
+    double& operator[] (std::size_t k) const {
+      return arr.coef[k].raw_data()[off];
+    }
+
+    /* Compound assignment operators. */
+    template<typename T>
+    reference& operator+= (const T& y) { return *this = at() + y; }
+    template<typename T>
+    reference& operator-= (const T& y) { return *this = at() - y; }
+    template<typename T>
+    reference& operator*= (const T& y) { return *this = at() * y; }
+    template<typename T>
+    reference& operator/= (const T& y) { return *this = at() / y; }
+
+  private:
+    /* at(): gather the element. */
+    base_type at () const { return arr.at(off); }
+
+    /* Proxy state:
+     *  @arr: referenced array.
+     *  @off: linear offset of the referenced element.
+     */
+    planar& arr;
+    std::size_t off;
+  };
+
+  /* is_operand<T>
+   *
+   * Whether a type is accepted by the assignment operators: either
+   * a non-indexable value, or an array or expression that shares the
+   * index type of the array.
+   */
+  template<typename T>
+  static constexpr bool is_operand =
+    !hx::op::is_indexable_v<T> || hx::op::has_index_v<T, index_type>;
+
+  /* planar(): default constructor. */
+  planar () {}
+
+  /* delete the implicit copy constructor. */
+  planar (const planar& x) = delete;
+
+  /* operator[](index_type) */
+  reference operator[] (const index_type& idx) {
+    return reference(*this, idx.pack_right());
+  }
+
+  /* operator[](index_type) const */
+  base_type operator[] (const index_type& idx) const {
+    return at(idx.pack_right());
+  }
+
+  /* at()
+   *
+   * Return the element at a linear offset, gathered from all planes.
+   */
+  base_type at (std::size_t i) const {
+    base_type x;
+    for (std::size_t k = 0; k < planes; k++)
+      x[k] = coef[k].raw_data()[i];
+
+    return x;
+  }
+
+  /* plane(): return the coefficient plane k. */
+  plane_type& plane (std::size_t k) { return coef[k]; }
+  const plane_type& plane (std::size_t k) const { return coef[k]; }
+
+  /* real(): return the plane of real coefficients. */
+  plane_type& real () { return coef[0]; }
+  const plane_type& real () const { return coef[0]; }
+
+  /* operator=(value or expression)
+   *
+   * Assignment operator from scalar values, arrays and array
+   * expressions.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  planar& operator= (const T& rhs) {
+    return assign(hx::exec::seq, rhs);
+  }
+
+  /* assign()
+   *
+   * Assign a scalar value, array or array expression to all array
+   * elements under an execution policy, scattering each element
+   * into the planes.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  planar& assign (hx::exec::policy p, const T& rhs) {
+    hx::exec::for_range(p, size, grain,
+      [this, &rhs] (std::size_t i0, std::size_t i1) {
+        if constexpr (!hx::op::is_indexable_v<T>) {
+          base_type x;
+          x += rhs;
+          for (std::size_t k = 0; k < planes; k++)
+            std::fill(coef[k].raw_data() + i0, coef[k].raw_data() + i1,
+                      x[k]);
+        }
+        else if constexpr (hx::op::is_flat_v<T>) {
+          for (std::size_t i = i0; i < i1; i++)
+            store(i, hx::op::flat(rhs, i));
+        }
+        else {
+          index_type idx;
+          idx.unpack_right(i0);
+          for (std::size_t i = i0; i < i1; i++, idx++)
+            store(i, rhs[idx]);
+        }
+      });
+
+    return *this;
+  }
+
+  /* foreach_vector()
+   *
+   * Execute a function for each vector along a single dimension of
+   * the array. Each vector is gathered from the planes into a buffer
+   * of interleaved elements, passed to the function as an hx::vector
+   * over that buffer, and scattered back into the planes.
+   */
+  template<std::size_t dim, typename Lambda,
+           typename = std::enable_if_t<(dim < ndims)>>
+  void foreach_vector (const Lambda& f) {
+    constexpr std::size_t n = shape<dim>;
+    constexpr std::size_t stride = index_type::template stride<dim>;
+    using buffer_type = hx::array<base_type, n>;
+    using vector_type = hx::vector<buffer_type, 0, n>;
+
+    auto buf = std::make_unique<buffer_type>();
+    base_type* x = buf->raw_data();
+    hx::dim<dim> skip;
+    index_type idx;
+
+    do {
+      const std::size_t off = idx.pack_right();
+      for (std::size_t i = 0; i < n; i++)
+        x[i] = at(off + i * stride);
+
+      vector_type v{*buf};
+      f(v);
+
+      for (std::size_t i = 0; i < n; i++)
+        store(off + i * stride, x[i]);
+    }
+    while (idx += skip);
+  }
+
+  /* foreach_plane()
+   *
+   * Execute a function for each coefficient plane of the array.
+   * The function should accept the plane (a plane_type&) as its
+   * only argument.
+   */
+  template<typename Lambda>
+  void foreach_plane (const Lambda& f) {
+    for (std::size_t k = 0; k < planes; k++)
+      f(coef[k]);
+  }
+
+  /* squared_norms()
+   *
+   * Compute the squared norm of every element into an array of
+   * doubles, accumulating one unit-stride plane at a time.
+   */
+  void squared_norms (plane_type& out,
+                      hx::exec::policy p = hx::exec::seq) const {
+    double* y = out.raw_data();
+    hx::exec::for_range(p, size, grain,
+      [this, y] (std::size_t i0, std::size_t i1) {
+        const double* x = coef[0].raw_data();
+        for (std::size_t i = i0; i < i1; i++)
+          y[i] = x[i] * x[i];
+
+        for (std::size_t k = 1; k < planes; k++) {
+          x = coef[k].raw_data();
+          for (std::size_t i = i0; i < i1; i++)
+            y[i] += x[i] * x[i];
+        }
+      });
+  }
+
+  /* norms()
+   *
+   * Compute the norm of every element into an array of doubles.
+   */
+  void norms (plane_type& out, hx::exec::policy p = hx::exec::seq) const {
+    squared_norms(out, p);
+    out.foreach(p, [] (double& v) { v = std::sqrt(v); });
+  }
+
+private:
+  /* Internal state:
+   *  @coef: coefficient planes.
+   */
+  plane_type coef[planes];
+
+  /* @grain: number of elements of each task under parallel policies. */
+  static constexpr std::size_t grain = hx::exec::grain<base_type>(1);
+
+  /* store(): scatter an element to all planes. */
+  void store (std::size_t i, const base_type& x) {
+    for (std::size_t k = 0; k < planes; k++)
+      coef[k].raw_data()[i] = x[k];
+  }
+};
+
+/* is_array<planar<Dim, Dims...>>
+ *
+ * Planar arrays accept the same element-wise operators
+ * and functions as hx::array.
+ */
+template<std::size_t Dim, std::size_t... Dims>
+struct is_array<hx::planar<Dim, Dims...>> : public std::true_type {};
+
+/* array_type<planar<Dim, Dims...>>
+ *
+ * Partial specialization of array_type<T> for planar arrays.
+ */
+template<std::size_t Dim, std::size_t... Dims>
+struct array_type<hx::planar<Dim, Dims...>> {
+  using type = hx::scalar<Dim>;
+};
+
+/* array_dims<planar<Dim, Dims...>>
+ *
+ * Partial specialization of array_dims<T> for planar arrays.
+ */
+template<std::size_t Dim, std::size_t... Dims>
+struct array_dims<hx::planar<Dim, Dims...>> {
+  using type = hx::dims<Dims...>;
+};
+
+/* is_planar<T>
+ *
+ * Struct template for checking if a type is a planar array.
+ */
+template<typename T>
+struct is_planar : public std::false_type {};
+/**/
+template<std::size_t Dim, std::size_t... Dims>
+struct is_planar<hx::planar<Dim, Dims...>> : public std::true_type {};
+/**/
+template<typename T>
+inline constexpr bool is_planar_v = is_planar<T>::value;
+
+/* namespace hx */ }
+
+namespace hx::op {
+
+/* is_flat<planar<Dim, Dims...>>
+ *
+ * Planar arrays may be evaluated at linear offsets through at().
+ */
+template<std::size_t Dim, std::size_t... Dims>
+struct is_flat<hx::planar<Dim, Dims...>> : public std::true_type {};
+
+/* namespace hx::op */ }
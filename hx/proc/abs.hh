@@ -10,7 +10,8 @@ namespace hx::proc {
 /* hx::proc::abs<In>
  *
  * Processor that converts complex arrays to real arrays by taking
- * the multicomplex modulus of each array element.
+ * the multicomplex modulus of each array element. Planar arrays are
+ * converted by accumulating their coefficient planes.
  */
 template<typename In>
 struct abs {
@@ -19,13 +20,19 @@ struct abs {
   using Out = hx::build_array_t<double, hx::array_dims_t<In>>;
 
   /* operator()() */
-  void operator() (const std::unique_ptr<In>& in,
-                   const std::unique_ptr<Out>& out) const {
-    typename Out::index_type idx;
-    do {
-      (*out)[idx] = (*in)[idx].norm();
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
+    if constexpr (hx::is_planar_v<In>) {
+      in->norms(*out, hx::exec::par);
+    }
+    else {
+      typename Out::cursor_type cur;
+      do {
+        (*out)[cur] = (*in)[cur].norm();
+      }
+      while (cur++);
     }
-    while (idx++);
   }
 };
 
@@ -5,15 +5,35 @@
 
 #pragma once
 
+#include <vector>
+
 namespace hx::proc {
 
-/* hx::proc::fft<In, Dim>
+/* hx::proc::fft<In, Dim, Strategy>
  *
  * Processor that computes the fast Fourier transform
- * along dimension Dim of an array.
+ * along dimension Dim of an array. Planar arrays are
+ * interleaved into the output before transforming.
  */
-template<typename In, std::size_t Dim>
+template<typename In, std::size_t Dim,
+         hx::fft::strategy Strategy = hx::fft::automatic>
 struct fft {
+private:
+  /* outer()
+   *
+   * Return the number of points of all dimensions before Dim.
+   */
+  template<std::size_t... Ds>
+  static constexpr std::size_t outer (hx::dims<Ds...>) {
+    constexpr std::size_t shape[] = {Ds...};
+    std::size_t n = 1;
+    for (std::size_t d = 0; d < Dim; d++)
+      n *= shape[d];
+
+    return n;
+  }
+
+public:
   /* Type: scalar type of the input and output arrays.
    * Dims: transformed array dimensions type.
    */
@@ -24,16 +44,61 @@ struct fft {
    */
   using Out = hx::build_array_t<Type, Dims>;
 
+  /* Transform geometry:
+   *  @size: number of points along dimension Dim.
+   *  @stride: distance between successive points along Dim.
+   *  @mode: strategy used to apply the transforms.
+   */
+  static constexpr std::size_t size = Dims::template get<Dim>;
+  static constexpr std::size_t stride = Out::size / outer(Dims{}) / size;
+  static constexpr hx::fft::strategy mode =
+    Strategy != hx::fft::automatic ? Strategy
+      : hx::fft::choose_strategy(size, stride, sizeof(Type));
+
   /* operator()() */
-  void operator() (const std::unique_ptr<In>& in,
-                   const std::unique_ptr<Out>& out) const {
-    constexpr std::size_t size = Dims::template get<Dim>;
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
     auto f = hx::fft::forward<Type, size, Dim + 1>{};
 
-    *out = *in;
-    out->template foreach_vector<Dim>(f);
+    if constexpr (hx::is_planar_v<In>)
+      out->assign(hx::exec::par, *in);
+    else
+      hx::copy(*out, *in, hx::exec::par);
+
+    if constexpr (mode == hx::fft::transposed && stride > 1)
+      panels(out->raw_data(), f);
+    else
+      out->template foreach_vector<Dim>(f);
+  }
+
+private:
+  /* panels()
+   *
+   * Apply the transform to blocks of vectors that are transposed
+   * into a contiguous panel, so that all transforms run at unit stride.
+   */
+  template<typename F>
+  static void panels (Type* x, const F& f) {
+    /* @budget: approximate number of bytes used by each panel. */
+    constexpr std::size_t budget = std::size_t(1) << 18;
+    constexpr std::size_t fit = budget / (size * sizeof(Type));
+    constexpr std::size_t width = (fit < 1 ? 1 : fit > stride ? stride : fit);
+
+    std::vector<Type> buf(size * width);
+    for (std::size_t o = 0; o < Out::size; o += size * stride) {
+      for (std::size_t c = 0; c < stride; c += width) {
+        const std::size_t w = (c + width > stride ? stride - c : width);
+        Type* src = x + o + c;
+
+        hx::transpose(src, stride, buf.data(), size, size, w);
+        for (std::size_t j = 0; j < w; j++)
+          f(buf.data() + j * size);
+
+        hx::transpose(buf.data(), size, src, stride, w, size);
+      }
+    }
   }
 };
 
 /* namespace hx::proc */ }
-
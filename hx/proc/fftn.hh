@@ -0,0 +1,58 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::proc {
+
+/* hx::proc::fftn<In, Dims...>
+ *
+ * Processor that computes the fast Fourier transform along several
+ * dimensions of an array at once. Power-of-two dimensions are
+ * transformed by a single vector-radix transform, and all others
+ * fall back to successive transforms along each dimension. Planar
+ * arrays are interleaved into the output before transforming.
+ */
+template<typename In, std::size_t... Dims>
+struct fftn {
+  /* Type: scalar type of the input and output arrays.
+   * Shape: array dimensions type.
+   */
+  using Type = hx::array_type_t<In>;
+  using Shape = hx::array_dims_t<In>;
+
+  /* Out: array of identical scalar type and shape.
+   */
+  using Out = hx::build_array_t<Type, Shape>;
+
+  /* @pow2: whether all transformed dimensions are powers of two.
+   */
+  static constexpr bool pow2 =
+    ((Shape::template get<Dims> >= 2 &&
+      (Shape::template get<Dims> & (Shape::template get<Dims> - 1)) == 0)
+     && ...);
+
+  /* operator()() */
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
+    if constexpr (hx::is_planar_v<In>)
+      out->assign(hx::exec::par, *in);
+    else
+      hx::copy(*out, *in, hx::exec::par);
+
+    if constexpr (pow2) {
+      const hx::fft::multi<Out, hx::fft::fwd, Dims...> f;
+      f(*out);
+    }
+    else {
+      (out->template foreach_vector<Dims>(
+         hx::fft::forward<Type, Shape::template get<Dims>, Dims + 1>{}),
+       ...);
+    }
+  }
+};
+
+/* namespace hx::proc */ }
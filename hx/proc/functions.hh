@@ -15,12 +15,27 @@ constexpr auto abs () const {
 }
 
 /* fft() */
-template<std::size_t Dim = 0>
+template<std::size_t Dim = 0,
+         hx::fft::strategy Strategy = hx::fft::automatic>
 constexpr auto fft () const {
-  using ft = hx::proc::fft<output, Dim>;
+  using ft = hx::proc::fft<output, Dim, Strategy>;
+  return hx::proc::node<node, ft>{*this, ft{}};
+}
+
+/* fftn() */
+template<std::size_t... Ds>
+constexpr auto fftn () const {
+  using ft = hx::proc::fftn<output, Ds...>;
   return hx::proc::node<node, ft>{*this, ft{}};
 }
 
+/* hilbert() */
+template<std::size_t Dim = 0>
+constexpr auto hilbert () const {
+  using ht = hx::proc::hilbert<output, Dim>;
+  return hx::proc::node<node, ht>{*this, ht{}};
+}
+
 /* real() */
 constexpr auto real () const {
   using re = hx::proc::real<output>;
@@ -0,0 +1,51 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx::proc {
+
+/* hx::proc::hilbert<In, Dim>
+ *
+ * Processor that regenerates the imaginary coefficients along
+ * dimension Dim of an array by a Hilbert transform. Real arrays
+ * and arrays of hx::scalar<Dim> are promoted to hx::scalar<Dim+1>
+ * to hold the regenerated coefficients.
+ */
+template<typename In, std::size_t Dim>
+struct hilbert {
+  /* Type: scalar type of the input array.
+   * Dims: transformed array dimensions type.
+   */
+  using Type = hx::array_type_t<In>;
+  using Dims = hx::array_dims_t<In>;
+
+  /* Scalar: scalar type of the output array.
+   */
+  static constexpr std::size_t k = hx::scalar_dims_v<Type>;
+  using Scalar = hx::scalar<(k > Dim ? k : Dim + 1)>;
+
+  /* Out: array of promoted scalar type and identical shape.
+   */
+  using Out = hx::build_array_t<Scalar, Dims>;
+
+  /* operator()() */
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
+    constexpr std::size_t size = Dims::template get<Dim>;
+    auto f = hx::fft::hilbert<Scalar, size, Dim + 1>{};
+
+    typename Out::cursor_type cur;
+    do {
+      (*out)[cur] = Scalar(hx::scalar<k>((*in)[cur]));
+    }
+    while (cur++);
+
+    out->template foreach_vector<Dim>(f);
+  }
+};
+
+/* namespace hx::proc */ }
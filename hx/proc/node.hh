@@ -6,9 +6,13 @@
 #pragma once
 
 #include <memory>
+#include <new>
+#include <type_traits>
 
 #include "abs.hh"
 #include "fft.hh"
+#include "fftn.hh"
+#include "hilbert.hh"
 #include "real.hh"
 #include "zerofill.hh"
 
@@ -46,9 +50,9 @@ public:
    *
    * Call operator for general processing nodes.
    */
-  template<typename T>
-  auto operator() (const std::unique_ptr<T>& in) const {
-    auto out = std::make_unique<output>();
+  template<typename T, typename Deleter>
+  auto operator() (const std::unique_ptr<T, Deleter>& in) const {
+    auto out = allocate<Deleter>();
     processor(parent(in), out);
     return std::move(out);
   }
@@ -70,6 +74,25 @@ public:
 #include "functions.hh"
 
 private:
+  /* allocate()
+   *
+   * Allocate the output array of the node in the same manner as the
+   * source array: through hx::make_array() for pointers that own a
+   * memory mapping, or on the free store otherwise.
+   */
+  template<typename Deleter>
+  static auto allocate () {
+    if constexpr (std::is_same_v<Deleter, hx::alloc::deleter>) {
+      auto out = hx::make_array<output>();
+      if (!out)
+        throw std::bad_alloc();
+
+      return out;
+    }
+    else
+      return std::make_unique<output>();
+  }
+
   /* Internal state:
    *  @parent: upstream processing node.
    *  @processor: processor of the current node.
@@ -81,7 +104,8 @@ private:
 /* hx::proc::node<hx::array<Type, Dims...>, void>
  *
  * Partial specialization of the hx::proc::node class for nodes
- * which take their input from unique pointers to arrays.
+ * which take their input from unique pointers to arrays, which
+ * may be const, e.g. read-only hx::mapped_array's.
  */
 template<typename Type, std::size_t... Dims>
 class node<hx::array<Type, Dims...>, void> {
@@ -105,13 +129,51 @@ public:
    * Constructor for array-sourced processing nodes taking a unique
    * pointer to an array.
    */
-  constexpr node (const std::unique_ptr<In>& in) {}
+  template<typename T, typename Deleter, typename = std::enable_if_t<
+             std::is_same_v<std::remove_const_t<T>, In>>>
+  constexpr node (const std::unique_ptr<T, Deleter>& in) {}
 
   /* operator()
    *
    * Call operator for array-sourced processing nodes.
    */
-  const auto& operator() (const std::unique_ptr<In>& in) const {
+  template<typename T, typename Deleter, typename = std::enable_if_t<
+             std::is_same_v<std::remove_const_t<T>, In>>>
+  const auto& operator() (const std::unique_ptr<T, Deleter>& in) const {
+    return in;
+  }
+
+/* include the set of node extension functions. */
+#include "functions.hh"
+};
+
+/* hx::proc::node<hx::planar<D, Dims...>, void>
+ *
+ * Partial specialization of the hx::proc::node class for nodes
+ * which take their input from unique pointers to planar arrays.
+ */
+template<std::size_t D, std::size_t... Dims>
+class node<hx::planar<D, Dims...>, void> {
+public:
+  /* In: for consistency with the general node<T,P> code above. */
+  using In = hx::planar<D, Dims...>;
+
+  /* input, output: type of the input array. */
+  using input = In;
+  using output = In;
+
+  /* link_id: always zero for array-sourced nodes. */
+  using link_id = std::integral_constant<std::size_t, 0>;
+
+  /* node(): constructor taking a unique pointer to an array. */
+  template<typename T, typename Deleter, typename = std::enable_if_t<
+             std::is_same_v<std::remove_const_t<T>, In>>>
+  constexpr node (const std::unique_ptr<T, Deleter>& in) {}
+
+  /* operator(): call operator for array-sourced nodes. */
+  template<typename T, typename Deleter, typename = std::enable_if_t<
+             std::is_same_v<std::remove_const_t<T>, In>>>
+  const auto& operator() (const std::unique_ptr<T, Deleter>& in) const {
     return in;
   }
 
@@ -120,10 +182,11 @@ public:
 };
 
 /* template argument deduction guide for nodes constructed from
- * unique pointers to objects of type T.
+ * unique pointers to objects of type T, including those returned
+ * by hx::make_array() and read-only hx::mapped_array's.
  */
-template<typename T>
-node(const std::unique_ptr<T>&) -> node<T, void>;
+template<typename T, typename Deleter>
+node(const std::unique_ptr<T, Deleter>&) -> node<std::remove_const_t<T>, void>;
 
 /* namespace hx::proc */ }
 
@@ -10,7 +10,8 @@ namespace hx::proc {
 /* hx::proc::real<In>
  *
  * Processor that converts complex arrays to real arrays by dropping
- * all imaginary coefficients.
+ * all imaginary coefficients. Planar arrays are converted by copying
+ * their plane of real coefficients.
  */
 template<typename In>
 struct real {
@@ -19,13 +20,19 @@ struct real {
   using Out = hx::build_array_t<double, hx::array_dims_t<In>>;
 
   /* operator()() */
-  void operator() (const std::unique_ptr<In>& in,
-                   const std::unique_ptr<Out>& out) const {
-    typename Out::index_type idx;
-    do {
-      (*out)[idx] = (*in)[idx][0];
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
+    if constexpr (hx::is_planar_v<In>) {
+      hx::copy(*out, in->real(), hx::exec::par);
+    }
+    else {
+      typename Out::cursor_type cur;
+      do {
+        (*out)[cur] = (*in)[cur][0];
+      }
+      while (cur++);
     }
-    while (idx++);
   }
 };
 
@@ -25,15 +25,11 @@ struct zerofill {
   using Out = hx::build_array_t<Type, Dims>;
 
   /* operator()() */
-  void operator() (const std::unique_ptr<In>& in,
-                   const std::unique_ptr<Out>& out) const {
-    typename In::index_type idx_in;
-    typename Out::index_type idx_out;
-    do {
-      idx_out = idx_in;
-      (*out)[idx_out] = (*in)[idx_in];
-    }
-    while (idx_in++);
+  template<typename Tin, typename Din, typename Dout>
+  void operator() (const std::unique_ptr<Tin, Din>& in,
+                   const std::unique_ptr<Out, Dout>& out) const {
+    constexpr std::array<std::size_t, In::ndims> lo{};
+    hx::copy_box(*in, lo, *out, lo, hx::extents(*in), true, hx::exec::par);
   }
 };
 
@@ -0,0 +1,126 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <utility>
+
+namespace hx {
+
+/* index_count<Idx>
+ *
+ * Struct template for getting the number of elements
+ * addressed by an index type.
+ */
+template<typename Idx>
+struct index_count;
+
+/* index_count<index<Sizes...>> */
+template<std::size_t... Sizes>
+struct index_count<hx::index<Sizes...>>
+ : public std::integral_constant<std::size_t, (Sizes * ...)> {};
+
+/* element()
+ *
+ * Return the element of an array or expression at a linear offset,
+ * evaluated at flat offsets when possible, and by index otherwise.
+ */
+template<typename T>
+inline auto element (const T& x, std::size_t i) {
+  if constexpr (hx::op::is_flat_v<T>) {
+    return hx::op::flat(x, i);
+  }
+  else {
+    hx::op::index_type<T> idx;
+    idx.unpack_right(i);
+    return x[idx];
+  }
+}
+
+/* reduce()
+ *
+ * Reduce all elements of an array or array expression to a single
+ * value through a binary function, in a single pass without forming
+ * a temporary array. Results are identical under every policy.
+ */
+template<typename T, typename Op,
+         typename = std::enable_if_t<hx::is_lazy_operand_v<T>>>
+auto reduce (const T& x, const Op& op,
+             hx::exec::policy p = hx::exec::seq) {
+  constexpr std::size_t n = hx::index_count<hx::op::index_type<T>>::value;
+  using V = decltype(hx::element(x, 0));
+
+  return hx::exec::reduce(p, n, hx::exec::grain<V>(1),
+    [&x] (std::size_t i) { return hx::element(x, i); }, op);
+}
+
+/* sum()
+ *
+ * Return the sum of all elements of an array or array expression,
+ * optionally using compensated summation.
+ */
+template<typename T,
+         typename = std::enable_if_t<hx::is_lazy_operand_v<T>>>
+auto sum (const T& x, hx::exec::policy p = hx::exec::seq,
+          hx::exec::compensation c = hx::exec::none) {
+  constexpr std::size_t n = hx::index_count<hx::op::index_type<T>>::value;
+  using V = decltype(hx::element(x, 0));
+
+  return hx::exec::sum(p, c, n, hx::exec::grain<V>(1),
+    [&x] (std::size_t i) { return hx::element(x, i); });
+}
+
+/* dot()
+ *
+ * Return the sum of the element-wise products of two arrays or
+ * array expressions. As for hx::vector products, no operand
+ * is conjugated.
+ */
+template<typename Ta, typename Tb,
+         typename = std::enable_if_t<hx::is_lazy_operand_v<Ta> &&
+                                     hx::is_lazy_operand_v<Tb>>>
+auto dot (const Ta& a, const Tb& b, hx::exec::policy p = hx::exec::seq,
+          hx::exec::compensation c = hx::exec::none) {
+  return hx::sum(hx::op::binary<hx::op::times, hx::lazy_operand<Ta>,
+                                hx::lazy_operand<Tb>>(a, b), p, c);
+}
+
+/* max_norm()
+ *
+ * Return the largest norm of all elements of an array
+ * or array expression.
+ */
+template<typename T,
+         typename = std::enable_if_t<hx::is_lazy_operand_v<T>>>
+double max_norm (const T& x, hx::exec::policy p = hx::exec::seq) {
+  return hx::reduce(hx::norm(x),
+    [] (double a, double b) { return a < b ? b : a; }, p);
+}
+
+/* argmax_norm()
+ *
+ * Return the index of the element of an array or array expression
+ * having the largest norm. Ties resolve to the earliest element.
+ */
+template<typename T,
+         typename = std::enable_if_t<hx::is_lazy_operand_v<T>>>
+auto argmax_norm (const T& x, hx::exec::policy p = hx::exec::seq) {
+  using best = std::pair<double, std::size_t>;
+  constexpr std::size_t n = hx::index_count<hx::op::index_type<T>>::value;
+
+  const best top = hx::exec::reduce(p, n, hx::exec::grain<best>(1),
+    [&x] (std::size_t i) { return best{hx::norm(hx::element(x, i)), i}; },
+    [] (const best& a, const best& b) {
+      const bool take = (b.first > a.first ||
+                         (b.first == a.first && b.second < a.second));
+      return take ? b : a;
+    });
+
+  hx::op::index_type<T> idx;
+  idx.unpack_right(top.second);
+  return idx;
+}
+
+/* namespace hx */ }
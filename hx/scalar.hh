@@ -124,6 +124,15 @@ public:
     return *this;
   }
 
+  /* operator*=(scalar)
+   *
+   * Combined multiplication-assignment operator.
+   */
+  constexpr scalar& operator*= (const scalar& b) {
+    *this = *this * b;
+    return *this;
+  }
+
   /* operator*=(double)
    *
    * Combined real multiplication-assignment operator.
@@ -134,6 +143,15 @@ public:
     return *this;
   }
 
+  /* operator/=(scalar)
+   *
+   * Combined division-assignment operator.
+   */
+  constexpr scalar& operator/= (const scalar& b) {
+    *this = *this / b;
+    return *this;
+  }
+
   /* operator/=(double)
    *
    * Combined real division-assignment operator.
@@ -314,12 +332,12 @@ public:
 
   /* squaredNorm()
    *
-   * Returns the sum of squares of the coefficients of a scalar. Due to
-   * the properties of the algebra, (x * ~x) is not purely real for
-   * Dim > 1, so we just return the real coefficient.
+   * Returns the sum of squares of the coefficients of a scalar. This
+   * equals the real coefficient of (x * ~x), which is not purely real
+   * for Dim > 1, but is summed directly instead of forming the product.
    */
   constexpr double squaredNorm () const {
-    return ((*this) * ~(*this))[0];
+    return real.squaredNorm() + imag.squaredNorm();
   }
 
   /* norm()
@@ -526,6 +544,16 @@ public:
     return os;
   }
 
+  /* squaredNorm() */
+  constexpr double squaredNorm () const {
+    return real * real;
+  }
+
+  /* norm() */
+  double norm () const {
+    return std::abs(real);
+  }
+
   /* inverse()
    *
    * Returns the multiplicative inverse of a real number.
@@ -578,5 +606,28 @@ struct is_scalar<hx::scalar<Dim>> : public std::true_type {};
 template<typename T>
 inline constexpr bool is_scalar_v = hx::is_scalar<T>::value;
 
+/* scalar_dims<T>
+ *
+ * Struct template for getting the number of imaginary units of
+ * a scalar type. Real numbers are treated as hx::scalar<0>.
+ */
+template<typename T>
+struct scalar_dims : public std::integral_constant<std::size_t, 0> {};
+
+/* scalar_dims<scalar<Dim>>
+ *
+ * Specialization of scalar_dims<T> for multicomplex scalars.
+ */
+template<std::size_t Dim>
+struct scalar_dims<hx::scalar<Dim>>
+ : public std::integral_constant<std::size_t, Dim> {};
+
+/* scalar_dims_v<T>
+ *
+ * Constant expression returning the value of scalar_dims<T>.
+ */
+template<typename T>
+inline constexpr std::size_t scalar_dims_v = hx::scalar_dims<T>::value;
+
 /* namespace hx */ }
 
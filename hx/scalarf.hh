@@ -0,0 +1,145 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include "scalar.hh"
+
+namespace hx {
+
+/* hx::scalarf<Dim>
+ *
+ * Single-precision storage class for multicomplex numbers. Holds the
+ * 2^Dim coefficients of an hx::scalar<Dim> as floats, and converts to
+ * and from hx::scalar<Dim> for all arithmetic.
+ */
+template<std::size_t Dim>
+class scalarf {
+public:
+  /* @n: number of stored coefficients. */
+  static constexpr std::size_t n = 1 << Dim;
+
+  /* scalarf()
+   *
+   * Default constructor, initializes all coefficients to zero.
+   */
+  constexpr scalarf () : coeffs{} {}
+
+  /* scalarf(scalar<Dim>)
+   *
+   * Narrowing constructor, rounds each coefficient of a
+   * double-precision scalar to single precision.
+   */
+  constexpr scalarf (const hx::scalar<Dim>& s) : coeffs{} {
+    for (std::size_t i = 0; i < n; i++)
+      coeffs[i] = float(s[i]);
+  }
+
+  /* operator scalar<Dim>()
+   *
+   * Widening conversion operator to double-precision scalars.
+   */
+  constexpr operator hx::scalar<Dim> () const {
+    hx::scalar<Dim> s;
+    for (std::size_t i = 0; i < n; i++)
+      s[i] = coeffs[i];
+
+    return s;
+  }
+
+  /* operator==()
+   *
+   * Equality comparison operator.
+   */
+  constexpr bool operator== (const scalarf& b) const {
+    for (std::size_t i = 0; i < n; i++)
+      if (coeffs[i] != b.coeffs[i])
+        return false;
+
+    return true;
+  }
+
+  /* operator!=()
+   *
+   * Inequality comparison operator.
+   */
+  constexpr bool operator!= (const scalarf& b) const {
+    return !(*this == b);
+  }
+
+  /* operator[]()
+   *
+   * Subscripting operator. Returns a single coefficient from
+   * a scalar without any bounds checking.
+   */
+  constexpr float& operator[] (std::size_t idx) {
+    return coeffs[idx];
+  }
+
+  /* operator[]() const */
+  constexpr float operator[] (std::size_t idx) const {
+    return coeffs[idx];
+  }
+
+  /* operator<<()
+   *
+   * Output stream operator.
+   */
+  friend std::ostream& operator<< (std::ostream& os, const scalarf& obj) {
+    return os << hx::scalar<Dim>(obj);
+  }
+
+private:
+  /* Internal state:
+   *  @coeffs: coefficients, in the order of hx::scalar<Dim>::operator[].
+   */
+  float coeffs[n];
+};
+
+/* is_scalarf<T>
+ *
+ * Struct template for checking if a type is a single-precision scalar.
+ */
+template<typename T>
+struct is_scalarf : public std::false_type {};
+
+/* is_scalarf<scalarf<Dim>>
+ *
+ * Specialization of is_scalarf<T> that yields a true value.
+ */
+template<std::size_t Dim>
+struct is_scalarf<hx::scalarf<Dim>> : public std::true_type {};
+
+/* is_scalarf_v<T>
+ *
+ * Constant expression returning the value of is_scalarf<T>.
+ */
+template<typename T>
+inline constexpr bool is_scalarf_v = hx::is_scalarf<T>::value;
+
+/* wide_type<T>
+ *
+ * Struct template for getting the type used for arithmetic on values
+ * stored as type T. Most types are their own wide type.
+ */
+template<typename T>
+struct wide_type { using type = T; };
+
+/* wide_type<scalarf<Dim>>
+ *
+ * Partial specialization of wide_type<T> for single-precision scalars,
+ * which are widened to double precision.
+ */
+template<std::size_t Dim>
+struct wide_type<hx::scalarf<Dim>> { using type = hx::scalar<Dim>; };
+
+/* wide_type_t<T>
+ *
+ * Type definition template for wide_type<T>.
+ */
+template<typename T>
+using wide_type_t = typename wide_type<T>::type;
+
+/* namespace hx */ }
@@ -0,0 +1,364 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+namespace hx {
+
+/* hx::tiled<Type, Tile, Dims...>
+ *
+ * Fixed-size multidimensional array stored in tiles of Tile elements
+ * along each dimension (or the full dimension, if smaller). Tiles are
+ * laid out in row-major order, and so are the elements of each tile,
+ * so that neighbors along every dimension share cache lines. Tiled
+ * arrays are indexed like hx::array<Type, Dims...>, and their vectors
+ * along any dimension are addressed through hx::vector_layout<>.
+ */
+template<typename Type, std::size_t Tile, std::size_t... Dims>
+class tiled {
+public:
+  /* Static properties:
+   *  @size: total number of array elements.
+   *  @ndims: number of array dimensions.
+   */
+  static constexpr std::size_t size = (Dims * ...);
+  static constexpr std::size_t ndims = sizeof...(Dims);
+
+  /* Type information:
+   *   base_type: type of each array element.
+   *   index_type: type of accepted indices to operator[].
+   */
+  using base_type = Type;
+  using index_type = hx::index<Dims...>;
+
+  /* shape<dim>
+   *
+   * Static member data template holding the array dimension sizes.
+   */
+  template<std::size_t dim, typename = std::enable_if_t<(dim < ndims)>>
+  static inline constexpr auto shape = index_type::template size<dim>();
+
+  /* Tile geometry:
+   *  @edge<dim>: extent of each tile along dimension dim.
+   *  @volume: number of elements in each tile.
+   *  @inner_stride<dim>: spacing between adjacent elements of a tile
+   *   along dimension dim.
+   *  @tile_stride<dim>: spacing between adjacent tiles along
+   *   dimension dim.
+   */
+  template<std::size_t dim>
+  static constexpr std::size_t edge = index_type::template tile<Tile>(dim);
+
+  static constexpr std::size_t volume = [] {
+    std::size_t v = 1;
+    for (std::size_t d = 0; d < ndims; d++)
+      v *= index_type::template tile<Tile>(d);
+
+    return v;
+  }();
+
+  /* every dimension must hold a whole number of tiles. */
+  static_assert(Tile > 0 && [] {
+    constexpr std::size_t sizes[] = {Dims...};
+    for (std::size_t d = 0; d < ndims; d++)
+      if (sizes[d] % index_type::template tile<Tile>(d) != 0)
+        return false;
+
+    return true;
+  }());
+
+  template<std::size_t dim>
+  static constexpr std::size_t inner_stride = [] {
+    std::size_t n = 1;
+    for (std::size_t d = dim + 1; d < ndims; d++)
+      n *= index_type::template tile<Tile>(d);
+
+    return n;
+  }();
+
+  template<std::size_t dim>
+  static constexpr std::size_t tile_stride = [] {
+    constexpr std::size_t sizes[] = {Dims...};
+    std::size_t n = volume;
+    for (std::size_t d = dim + 1; d < ndims; d++)
+      n *= sizes[d] / index_type::template tile<Tile>(d);
+
+    return n;
+  }();
+
+  /* is_operand<T>
+   *
+   * Whether a type is accepted by the assignment operators: either
+   * a non-indexable value, or an array or expression that shares the
+   * index type of the array.
+   */
+  template<typename T>
+  static constexpr bool is_operand =
+    !hx::op::is_indexable_v<T> || hx::op::has_index_v<T, index_type>;
+
+  /* tiled(): default constructor. */
+  tiled () {}
+
+  /* delete the implicit copy constructor. */
+  tiled (const tiled& x) = delete;
+
+  /* operator[](index_type)
+   *
+   * Subscripting operator with index argument. Returns the
+   * indexed array element without bounds checking.
+   */
+  Type& operator[] (const index_type& idx) {
+    return data[idx.template pack_tiled<Tile>()];
+  }
+
+  /* operator[](index_type) const */
+  Type operator[] (const index_type& idx) const {
+    return data[idx.template pack_tiled<Tile>()];
+  }
+
+  /* operator=(value or expression)
+   *
+   * Assignment operator from scalar values, arrays and array
+   * expressions.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& operator= (const T& rhs) {
+    return assign(hx::exec::seq, rhs);
+  }
+
+  /* assign()
+   *
+   * Assign a scalar value, array or array expression to all array
+   * elements under an execution policy.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& assign (hx::exec::policy p, const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x = y; }, p);
+  }
+
+  /* operator+=()
+   *
+   * Compound addition operator from scalar values, arrays and array
+   * expressions.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& operator+= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& operator-= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& operator*= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  tiled& operator/= (const T& rhs) {
+    return update(rhs, [] (Type& x, const auto& y) { x /= y; });
+  }
+
+  /* reduce()
+   *
+   * Reduce an array through a general lambda function, in storage
+   * order. The result is the same for every policy and thread count.
+   */
+  template<typename Lambda>
+  Type reduce (const Lambda& f) const {
+    return reduce(hx::exec::seq, f);
+  }
+
+  /* reduce(policy) */
+  template<typename Lambda>
+  Type reduce (hx::exec::policy p, const Lambda& f) const {
+    const Type* x = data;
+    return hx::exec::reduce(p, size, grain,
+      [x] (std::size_t i) { return x[i]; }, f);
+  }
+
+  /* min(): return the minimum element of an array. */
+  auto min (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a < b ? a : b;
+    });
+  }
+
+  /* max(): return the maximum element of an array. */
+  auto max (hx::exec::policy p = hx::exec::seq) const {
+    return reduce(p, [] (const Type& a, const Type& b) {
+      return a > b ? a : b;
+    });
+  }
+
+  /* sum()
+   *
+   * Return the sum of all elements of an array, optionally
+   * using compensated summation.
+   */
+  auto sum (hx::exec::policy p = hx::exec::seq,
+            hx::exec::compensation c = hx::exec::none) const {
+    const Type* x = data;
+    return hx::exec::sum(p, c, size, grain,
+      [x] (std::size_t i) { return x[i]; });
+  }
+
+  /* foreach_vector()
+   *
+   * Execute a function for each vector along a single dimension
+   * of an array. The function should accept the vector (an
+   * hx::vector<tiled, dim>) as its only argument.
+   */
+  template<std::size_t dim, typename Lambda,
+           typename = std::enable_if_t<(dim < ndims)>>
+  void foreach_vector (const Lambda& f) {
+    using vector_type = hx::vector<tiled, dim>;
+    using skip_type = hx::dim<dim>;
+
+    skip_type skip;
+    index_type idx;
+
+    do {
+      vector_type v{*this, idx};
+      f(v);
+    }
+    while (idx += skip);
+  }
+
+  /* foreach()
+   *
+   * Execute a function for each element of an array, in storage
+   * order. Parallel policies may call the function concurrently
+   * on different elements.
+   */
+  template<typename Lambda>
+  void foreach (const Lambda& f) {
+    foreach(hx::exec::seq, f);
+  }
+
+  /* foreach(policy) */
+  template<typename Lambda>
+  void foreach (hx::exec::policy p, const Lambda& f) {
+    Type* x = data;
+    hx::exec::for_range(p, size, grain,
+      [x, &f] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          f(x[i]);
+      });
+  }
+
+  /* storage_data()
+   *
+   * Return a pointer to the raw array of Type's, in tiled order.
+   * Unlike raw_data() of hx::array, the elements are not stored in
+   * row-major order, so tiled arrays are never read as contiguous
+   * operands by views, copies or flat expressions.
+   */
+  Type* storage_data () { return data; }
+  const Type* storage_data () const { return data; }
+
+private:
+  /* Internal state:
+   *  @data: array elements in tiled order.
+   */
+  Type data[size];
+
+  /* @grain: number of elements of each task under parallel policies. */
+  static constexpr std::size_t grain = hx::exec::grain<Type>(volume);
+
+  /* update()
+   *
+   * Implementation of the assignment and compound assignment operators.
+   * Values are applied directly, and all other operands are evaluated
+   * at the multidimensional index of each element. Parallel policies
+   * split the array into tasks of whole tiles.
+   */
+  template<typename T, typename Op>
+  tiled& update (const T& rhs, const Op& op,
+                 hx::exec::policy p = hx::exec::seq) {
+    Type* x = data;
+    constexpr std::size_t tiles = std::max<std::size_t>(1, grain / volume);
+    hx::exec::for_range(p, size / volume, tiles,
+      [x, &rhs, &op] (std::size_t t0, std::size_t t1) {
+        if constexpr (!hx::op::is_indexable_v<T>) {
+          for (std::size_t i = t0 * volume; i < t1 * volume; i++)
+            op(x[i], rhs);
+        }
+        else {
+          for (std::size_t t = t0; t < t1; t++) {
+            /* walk the elements of each tile in storage order. */
+            index_type idx;
+            idx.template unpack_tiled<Tile>(t * volume);
+            const index_type origin = idx;
+
+            for (std::size_t i = t * volume; i < (t + 1) * volume; i++) {
+              op(x[i], rhs[idx]);
+              for (std::size_t d = ndims; d > 0; d--) {
+                const std::size_t e = index_type::template tile<Tile>(d - 1);
+                if (++idx[d - 1] < origin[d - 1] + e)
+                  break;
+
+                idx[d - 1] = origin[d - 1];
+              }
+            }
+          }
+        }
+      });
+
+    return *this;
+  }
+};
+
+/* vector_layout<tiled<Type, Tile, Dims...>, Dim>
+ *
+ * Layout of vectors along the dimensions of tiled arrays.
+ */
+template<typename Type, std::size_t Tile, std::size_t... Dims,
+         std::size_t Dim>
+struct vector_layout<hx::tiled<Type, Tile, Dims...>, Dim> {
+  using array_type = hx::tiled<Type, Tile, Dims...>;
+  static constexpr std::size_t stride =
+    array_type::template inner_stride<Dim>;
+  static constexpr std::size_t edge = array_type::template edge<Dim>;
+  static constexpr std::size_t jump = array_type::template tile_stride<Dim>;
+};
+
+/* is_array<tiled<Type, Tile, Dims...>>
+ *
+ * Tiled arrays accept the same element-wise operators
+ * and functions as hx::array.
+ */
+template<typename Type, std::size_t Tile, std::size_t... Dims>
+struct is_array<hx::tiled<Type, Tile, Dims...>> : public std::true_type {};
+
+/* array_dims<tiled<Type, Tile, Dims...>>
+ *
+ * Partial specialization of array_dims<T> for tiled arrays.
+ */
+template<typename Type, std::size_t Tile, std::size_t... Dims>
+struct array_dims<hx::tiled<Type, Tile, Dims...>> {
+  using type = hx::dims<Dims...>;
+};
+
+/* namespace hx */ }
+
+namespace hx::op {
+
+/* is_flat<tiled<Type, Tile, Dims...>>
+ *
+ * Tiled arrays are not stored in row-major order, so they may
+ * not be evaluated at linear offsets alongside other arrays.
+ */
+template<typename Type, std::size_t Tile, std::size_t... Dims>
+struct is_flat<hx::tiled<Type, Tile, Dims...>> : public std::false_type {};
+
+/* namespace hx::op */ }
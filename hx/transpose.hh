@@ -0,0 +1,46 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+namespace hx {
+
+/* hx::transpose()
+ *
+ * Cache-oblivious out-of-place transpose of a rows-by-cols matrix
+ * with leading dimension ld_src into a cols-by-rows matrix with
+ * leading dimension ld_dst, i.e.:
+ *
+ *   dst[j * ld_dst + i] = src[i * ld_src + j]
+ *
+ * The larger dimension is split recursively until the sub-matrices
+ * are small enough to be transposed directly within the cache.
+ */
+template<typename Src, typename Dst>
+void transpose (Src src, std::size_t ld_src, Dst dst, std::size_t ld_dst,
+                std::size_t rows, std::size_t cols) {
+  /* @leaf: sub-matrix extent below which recursion stops. */
+  constexpr std::size_t leaf = 16;
+
+  if (rows <= leaf && cols <= leaf) {
+    for (std::size_t i = 0; i < rows; i++)
+      for (std::size_t j = 0; j < cols; j++)
+        dst[j * ld_dst + i] = src[i * ld_src + j];
+  }
+  else if (rows >= cols) {
+    const std::size_t h = rows / 2;
+    hx::transpose(src, ld_src, dst, ld_dst, h, cols);
+    hx::transpose(src + h * ld_src, ld_src, dst + h, ld_dst,
+                  rows - h, cols);
+  }
+  else {
+    const std::size_t h = cols / 2;
+    hx::transpose(src, ld_src, dst, ld_dst, rows, h);
+    hx::transpose(src + h, ld_src, dst + h * ld_dst, ld_dst,
+                  rows, cols - h);
+  }
+}
+
+/* namespace hx */ }
@@ -13,70 +13,78 @@ namespace hx {
  */
 constexpr double pi = 3.14159265358979323846264338327950288;
 
-/* hx::trig_series<m, n, k, K>
+/* hx::trig_series()
  *
  * Implementation of the Taylor series of sin(m*pi/n) and cos(m*pi/n)
- * based on a recursive factorization of the series terms into a
- * common factor, shown in the function body.
- */
-template<std::size_t m, std::size_t n, std::size_t k, std::size_t K>
-struct trig_series {
-  /* value(): multiplies in a new term of the series. */
-  static inline constexpr double value () {
-    return 1 - (double(m) * hx::pi / double(n))
-             * (double(m) * hx::pi / double(n))
-             / double(k * (k + 1))
-             * hx::trig_series<m, n, k + 2, K>::value();
-  }
-};
-
-/* hx::trig_series<m, n, K, K>
+ * based on a factorization of the series terms into a common factor,
+ * i.e. for x = m*pi/n:
+ *
+ *   1 - x^2 / (k (k+1)) * (1 - x^2 / ((k+2) (k+3)) * (1 - ...))
  *
- * Partial specialization of hx:trig_series<> that ends the recursive
- * series computation at K terms.
+ * evaluated from the innermost factor (k = K - 2) outwards.
  */
-template<std::size_t m, std::size_t n, std::size_t K>
-struct trig_series<m, n, K, K> {
-  /* value(): finalizes computation of the series. */
-  static inline constexpr double value () { return 1; }
-};
+constexpr double trig_series (std::size_t m, std::size_t n,
+                              std::size_t k, std::size_t K) {
+  const double x = double(m) * hx::pi / double(n);
+  double value = 1;
+  for (std::size_t j = K; j > k; j -= 2)
+    value = 1 - x * x / double((j - 2) * (j - 1)) * value;
 
-/* hx::sin<m, n>
+  return value;
+}
+
+/* hx::sin_pi()
  *
- * Struct implementing hx::trig_series<> to compute sin(m*pi/n).
+ * Compute sin(m*pi/n) using its Taylor series.
  */
-template<std::size_t m, std::size_t n>
-struct sin {
+constexpr double sin_pi (std::size_t m, std::size_t n) {
   /* Sine function parameters:
    *  @kmax: highest-order term in the trigonometric series.
    *  @mred: reduced numerator, extends sin() to +/-inf.
    */
-  static constexpr std::size_t kmax = 40;
-  static constexpr std::size_t mred = m % (2 * n);
+  constexpr std::size_t kmax = 40;
+  const std::size_t mred = m % (2 * n);
+
+  return (double(mred) * hx::pi / double(n))
+       * hx::trig_series(mred, n, 2, kmax);
+}
+
+/* hx::cos_pi()
+ *
+ * Compute cos(m*pi/n) using its Taylor series.
+ */
+constexpr double cos_pi (std::size_t m, std::size_t n) {
+  /* Cosine function parameters:
+   *  @kmax: highest-order term in the trigonometric series.
+   *  @mred: reduced numerator, extends cos() to +/-inf.
+   */
+  constexpr std::size_t kmax = 39;
+  const std::size_t mred = m % (2 * n);
 
+  return hx::trig_series(mred, n, 1, kmax);
+}
+
+/* hx::sin<m, n>
+ *
+ * Struct implementing hx::sin_pi() to compute sin(m*pi/n).
+ */
+template<std::size_t m, std::size_t n>
+struct sin {
   /* value(): computes the sine function using its taylor series. */
   static inline constexpr double value () {
-    return (double(mred) * hx::pi / double(n))
-         * hx::trig_series<mred, n, 2, kmax>::value();
+    return hx::sin_pi(m, n);
   }
 };
 
 /* hx::cos<m, n>
  *
- * Struct implementing hx::trig_series<> to compute cos(m*pi/n).
+ * Struct implementing hx::cos_pi() to compute cos(m*pi/n).
  */
 template<std::size_t m, std::size_t n>
 struct cos {
-  /* Cosine function parameters:
-   *  @kmax: highest-order term in the trigonometric series.
-   *  @mred: reduced numerator, extends cos() to +/-inf.
-   */
-  static constexpr std::size_t kmax = 39;
-  static constexpr std::size_t mred = m % (2 * n);
-
   /* value(): computes the cosine function using its taylor series. */
   static inline constexpr double value () {
-    return trig_series<mred, n, 1, kmax>::value();
+    return hx::cos_pi(m, n);
   }
 };
 
@@ -6,17 +6,52 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace hx {
 
+/* vector_layout<Array, Dim>
+ *
+ * In-memory layout of the elements along the dimension Dim of an
+ * array type Array:
+ *  @stride: spacing between elements with adjacent indices.
+ *  @edge: number of adjacent elements in each tile, or zero
+ *   for untiled arrays.
+ *  @jump: spacing between the first elements of adjacent tiles.
+ */
+template<typename Array, std::size_t Dim, typename = void>
+struct vector_layout {
+  static constexpr std::size_t stride =
+    Array::index_type::template stride<Dim>;
+  static constexpr std::size_t edge = 0;
+  static constexpr std::size_t jump = 0;
+};
+
+/* vector_first<Tiled>
+ *
+ * Position of the first element of a vector view within its tile,
+ * which is only stored by views of tiled arrays.
+ */
+template<bool Tiled>
+struct vector_first {
+  std::size_t xfirst = 0;
+};
+
+/* vector_first<false>: views of untiled arrays store nothing. */
+template<>
+struct vector_first<false> {};
+
 /* hx::vector<Array, Dim, Len>
  *
  * View of the data contained in an array type Array along
  * the dimension Dim, which follows pointer-like semantics.
+ * Elements of tiled arrays are addressed through their layout.
  */
 template<typename Array, std::size_t Dim = 0,
          std::size_t Len = Array::template shape<Dim>>
-class vector {
+class vector
+ : private hx::vector_first<(hx::vector_layout<Array, Dim>::edge > 0)> {
 public:
   /* Type information:
    *  base_type: type of the elements of the viewed array.
@@ -29,13 +64,18 @@ public:
    *
    * Constructor taking only an array.
    */
-  constexpr vector (Array& x) : xdata(x.raw_data()) {}
+  constexpr vector (Array& x) : xdata(origin(x)) {}
 
   /* vector(Array,index_type)
    *
    * Constructor taking an array and an index into that array.
    */
-  constexpr vector (Array& x, const index_type& idx) : xdata(&x[idx]) {}
+  constexpr vector (Array& x, const index_type& idx) : xdata(&x[idx]) {
+    if constexpr (Edge > 0) {
+      this->xfirst = idx[Dim] % Edge;
+      xdata -= this->xfirst * Stride;
+    }
+  }
 
   /* vector(base_type*)
    *
@@ -66,7 +106,7 @@ public:
    * at the @idx'th position of the vector view.
    */
   constexpr base_type& operator[] (std::size_t idx) {
-    return xdata[Stride * idx];
+    return xdata[offset(idx)];
   }
 
   /* operator()()
@@ -74,12 +114,12 @@ public:
    * Secondary subscripting operator.
    */
   constexpr base_type& operator() (std::size_t i) {
-    return xdata[Stride * i];
+    return xdata[offset(i)];
   }
 
   /* operator()() const */
   constexpr base_type operator() (std::size_t i) const {
-    return xdata[Stride * i];
+    return xdata[offset(i)];
   }
 
   /* operator+()
@@ -88,18 +128,160 @@ public:
    * that begins at the requested element of the vector view.
    */
   constexpr vector operator+ (std::size_t offset) const {
-    return {xdata + offset * Stride};
+    if constexpr (Edge > 0)
+      return {xdata, this->xfirst + offset};
+    else
+      return {xdata + offset * Stride};
+  }
+
+  /* is_operand<T>
+   *
+   * Struct template for checking if a type is accepted by the compound
+   * assignment operators: a non-indexable value, or a vector view of
+   * the same length.
+   */
+  template<typename T>
+  struct is_operand
+   : std::bool_constant<!hx::op::is_indexable_v<T>> {};
+
+  template<typename A, std::size_t D>
+  struct is_operand<hx::vector<A, D, Len>> : std::true_type {};
+
+  /* operator+=()
+   *
+   * Compound addition operator from scalar values and vector views
+   * of equal length. When the operand shares elements with this view
+   * at different positions, it is read in full before any writes.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  vector& operator+= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  vector& operator-= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x -= y; });
   }
 
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  vector& operator*= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>::value>>
+  vector& operator/= (const T& rhs) {
+    return update(rhs, [] (base_type& x, const auto& y) { x /= y; });
+  }
+
+  /* data(): pointer to the first viewed element. */
+  constexpr base_type* data () const { return xdata + offset(0); }
+
+  /* stride(): in-memory spacing between viewed elements. For tiled
+   * arrays, this only holds between elements of the same tile.
+   */
+  static constexpr std::size_t stride () { return Stride; }
+
+  /* tiled(): whether the viewed elements are stored in tiles. */
+  static constexpr bool tiled () { return Edge > 0; }
+
 private:
+  /* vector(base_type*,size_t)
+   *
+   * Constructor of tiled vector views that begin at the @first'th
+   * element from the start of a tile.
+   */
+  constexpr vector (base_type* ptr, std::size_t first) : xdata(ptr) {
+    this->xfirst = first;
+  }
+
+  /* origin()
+   *
+   * Return a pointer to the first stored element of an array.
+   */
+  static constexpr base_type* origin (Array& x) {
+    if constexpr (Edge > 0)
+      return x.storage_data();
+    else
+      return x.raw_data();
+  }
+
+  /* offset()
+   *
+   * Return the in-memory offset of the @i'th viewed element.
+   */
+  constexpr std::size_t offset (std::size_t i) const {
+    if constexpr (Edge > 0) {
+      i += this->xfirst;
+      return (i / Edge) * Jump + (i % Edge) * Stride;
+    }
+    else
+      return Stride * i;
+  }
+
+  /* update()
+   *
+   * Implementation of the compound assignment operators. Operands
+   * that may alias this view are first gathered into a heap buffer.
+   */
+  template<typename T, typename Op>
+  vector& update (const T& rhs, const Op& op) {
+    if constexpr (hx::op::is_indexable_v<T>) {
+      if (tiled() || T::tiled() || overlaps(rhs.data(), T::stride())) {
+        std::vector<typename T::base_type> tmp(Len);
+        for (std::size_t i = 0; i < Len; i++)
+          tmp[i] = rhs(i);
+
+        for (std::size_t i = 0; i < Len; i++)
+          op((*this)(i), tmp[i]);
+      }
+      else {
+        for (std::size_t i = 0; i < Len; i++)
+          op((*this)(i), rhs(i));
+      }
+    }
+    else {
+      for (std::size_t i = 0; i < Len; i++)
+        op((*this)(i), rhs);
+    }
+    return *this;
+  }
+
+  /* overlaps()
+   *
+   * Check whether a view of Len elements at @ptr spaced by @step
+   * shares memory with this view, other than by being identical.
+   */
+  template<typename T>
+  bool overlaps (const T* ptr, std::size_t step) const {
+    const auto a0 = reinterpret_cast<std::uintptr_t>(xdata);
+    const auto b0 = reinterpret_cast<std::uintptr_t>(ptr);
+    if (a0 == b0 && step * sizeof(T) == Stride * sizeof(base_type))
+      return false;
+
+    const auto a1 = a0 + ((Len - 1) * Stride + 1) * sizeof(base_type);
+    const auto b1 = b0 + ((Len - 1) * step + 1) * sizeof(T);
+    return a0 < b1 && b0 < a1;
+  }
+
   /* Static data members:
    *  @Stride: in-memory spacing between viewed elements with
-   *   adjacent indices.
+   *   adjacent indices (within a tile).
+   *  @Edge: number of viewed elements per tile, or zero.
+   *  @Jump: in-memory spacing between adjacent tiles.
    */
-  static constexpr std::size_t Stride = index_type::template stride<Dim>;
+  static constexpr std::size_t Stride =
+    hx::vector_layout<Array, Dim>::stride;
+  static constexpr std::size_t Edge = hx::vector_layout<Array, Dim>::edge;
+  static constexpr std::size_t Jump = hx::vector_layout<Array, Dim>::jump;
 
   /* Wrapped data:
-   *  @xdata: raw pointer to the start of the viewed array data.
+   *  @xdata: raw pointer to the start of the viewed array data,
+   *   or to the start of its first tile.
+   *  @xfirst: position of the first viewed element in its tile,
+   *   inherited from hx::vector_first<> by views of tiled arrays.
    */
   base_type* xdata;
 };
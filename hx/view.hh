@@ -0,0 +1,396 @@
+
+/* Copyright (c) 2021 Bradley Worley <geekysuavo@gmail.com>
+ * Released under the MIT License.
+ */
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "dynarray.hh"
+
+namespace hx {
+
+/* hx::view<Array>
+ *
+ * Zero-copy view of the elements of an hx::array or hx::dynarray,
+ * with an offset, extent and stride along each dimension and an
+ * arbitrary dimension order. Views follow pointer-like semantics:
+ * subscripting returns references into the viewed array.
+ */
+template<typename Array>
+class view {
+public:
+  /* Static properties:
+   *  @ndims: number of view dimensions.
+   */
+  static constexpr std::size_t ndims = Array::ndims;
+
+  /* Type information:
+   *   base_type: type of the elements of the viewed array.
+   *   index_type: type of indices into the view.
+   *   vector_type: strided one-dimensional view.
+   */
+  using base_type = typename Array::base_type;
+  using index_type = std::array<std::size_t, ndims>;
+  using vector_type = typename hx::dynarray<base_type, ndims>::vector_type;
+
+  /* is_operand<T>
+   *
+   * Whether a type is accepted by the assignment operators: either
+   * a non-indexable value, a view or expression of views of the same
+   * rank, or a row-major array (or expression of such arrays) holding
+   * as many elements as the view, read in row-major order. Operands
+   * must not overlap the view,
+   * unless they view the same elements in the same order. Operands
+   * of a different shape throw std::length_error on assignment.
+   */
+  template<typename T>
+  static constexpr bool is_operand =
+    hx::op::has_index_v<T, index_type> || hx::op::is_flat_v<T>;
+
+  /* view(Array)
+   *
+   * Constructor taking an array, viewing all of its elements.
+   */
+  explicit view (Array& x) : ptr(x.raw_data()) {
+    init(x, std::make_index_sequence<ndims>());
+
+    std::size_t n = 1;
+    for (std::size_t d = ndims; d > 0; d--) {
+      steps[d - 1] = n;
+      n *= extent[d - 1];
+    }
+  }
+
+  /* view(view): copy constructor. */
+  view (const view& other) = default;
+
+  /* slice()
+   *
+   * Return a view restricted to every @step'th element of the
+   * range [begin, end) along dimension d. Ranges that are reversed
+   * or exceed the view, and zero steps, throw std::invalid_argument.
+   */
+  view slice (std::size_t d, std::size_t begin, std::size_t end,
+              std::size_t step = 1) const {
+    if (d >= ndims || step == 0 || end < begin || end > extent[d])
+      throw std::invalid_argument("hx::view: invalid slice");
+
+    view v = *this;
+    v.ptr += begin * steps[d];
+    v.extent[d] = (end - begin + step - 1) / step;
+    v.steps[d] *= step;
+    return v;
+  }
+
+  /* permute()
+   *
+   * Return a view whose k'th dimension is the order[k]'th
+   * dimension of this view.
+   */
+  view permute (const index_type& order) const {
+    view v = *this;
+    for (std::size_t k = 0; k < ndims; k++) {
+      v.extent[k] = extent[order[k]];
+      v.steps[k] = steps[order[k]];
+    }
+
+    return v;
+  }
+
+  /* size(): total number of viewed elements. */
+  std::size_t size () const {
+    std::size_t n = 1;
+    for (std::size_t d = 0; d < ndims; d++)
+      n *= extent[d];
+
+    return n;
+  }
+
+  /* shape(): number of elements along dimension d. */
+  std::size_t shape (std::size_t d) const { return extent[d]; }
+
+  /* stride(): in-memory spacing of dimension d. */
+  std::size_t stride (std::size_t d) const { return steps[d]; }
+
+  /* data(): first viewed element. */
+  base_type* data () const { return ptr; }
+
+  /* operator[](index_type)
+   *
+   * Subscripting operator. Returns a reference to the viewed
+   * array element at the given index.
+   */
+  base_type& operator[] (const index_type& idx) const {
+    return ptr[offset(idx)];
+  }
+
+  /* operator=(value, view or expression) */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& operator= (const T& rhs) const {
+    return assign(hx::exec::seq, rhs);
+  }
+
+  /* operator=(view)
+   *
+   * Assignment operator copying the elements of another view
+   * of the same shape.
+   */
+  const view& operator= (const view& rhs) const {
+    return assign(hx::exec::seq, rhs);
+  }
+
+  /* assign()
+   *
+   * Assign a value, view, array or expression to all viewed
+   * elements under an execution policy.
+   */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& assign (hx::exec::policy p, const T& rhs) const {
+    return update(rhs, [] (base_type& x, const auto& y) { x = y; }, p);
+  }
+
+  /* operator+=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& operator+= (const T& rhs) const {
+    return update(rhs, [] (base_type& x, const auto& y) { x += y; });
+  }
+
+  /* operator-=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& operator-= (const T& rhs) const {
+    return update(rhs, [] (base_type& x, const auto& y) { x -= y; });
+  }
+
+  /* operator*=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& operator*= (const T& rhs) const {
+    return update(rhs, [] (base_type& x, const auto& y) { x *= y; });
+  }
+
+  /* operator/=() */
+  template<typename T, typename = std::enable_if_t<is_operand<T>>>
+  const view& operator/= (const T& rhs) const {
+    return update(rhs, [] (base_type& x, const auto& y) { x /= y; });
+  }
+
+  /* reduce()
+   *
+   * Reduce all viewed elements to a single element through a general
+   * lambda function, under an optional execution policy.
+   */
+  template<typename Lambda>
+  base_type reduce (const Lambda& f) const {
+    return reduce(hx::exec::seq, f);
+  }
+
+  /* reduce(policy) */
+  template<typename Lambda>
+  base_type reduce (hx::exec::policy p, const Lambda& f) const {
+    return hx::exec::reduce(p, size(), grain(),
+      [this] (std::size_t i) { return at(i); }, f);
+  }
+
+  /* sum() */
+  auto sum (hx::exec::policy p = hx::exec::seq,
+            hx::exec::compensation c = hx::exec::none) const {
+    return hx::exec::sum(p, c, size(), grain(),
+      [this] (std::size_t i) { return at(i); });
+  }
+
+  /* foreach()
+   *
+   * Execute a function for each viewed element, under an optional
+   * execution policy.
+   */
+  template<typename Lambda>
+  void foreach (const Lambda& f) const {
+    foreach(hx::exec::seq, f);
+  }
+
+  /* foreach(policy) */
+  template<typename Lambda>
+  void foreach (hx::exec::policy p, const Lambda& f) const {
+    if (size() == 0)
+      return;
+
+    hx::exec::for_range(p, size(), grain(),
+      [this, &f] (std::size_t i0, std::size_t i1) {
+        index_type idx = unpack(i0, extent);
+        for (std::size_t i = i0; i < i1; i++, next(idx, extent))
+          f(ptr[offset(idx)]);
+      });
+  }
+
+  /* foreach_vector()
+   *
+   * Execute a function for each vector along dimension d of the
+   * view. The function should accept a vector_type as its only
+   * argument, e.g. to apply an hx::fft::dynamic transform.
+   */
+  template<typename Lambda>
+  void foreach_vector (std::size_t d, const Lambda& f) const {
+    foreach_vector(hx::exec::seq, d, f);
+  }
+
+  /* foreach_vector(policy) */
+  template<typename Lambda>
+  void foreach_vector (hx::exec::policy p, std::size_t d,
+                       const Lambda& f) const {
+    if (size() == 0)
+      return;
+
+    index_type ext = extent;
+    ext[d] = 1;
+
+    const std::size_t n = extent[d];
+    const std::size_t per = std::max<std::size_t>(1, grain() / n);
+    hx::exec::for_range(p, size() / n, per,
+      [this, &f, ext, n, d] (std::size_t j0, std::size_t j1) {
+        index_type idx = unpack(j0, ext);
+        for (std::size_t j = j0; j < j1; j++, next(idx, ext))
+          f(vector_type{ptr + offset(idx), n, steps[d]});
+      });
+  }
+
+private:
+  /* Internal state:
+   *  @ptr: first viewed element.
+   *  @extent: number of viewed elements along each dimension.
+   *  @steps: in-memory spacing of each dimension.
+   */
+  base_type* ptr;
+  index_type extent;
+  index_type steps;
+
+  /* init()
+   *
+   * Copy the dimension sizes of the viewed array.
+   */
+  template<std::size_t... Is>
+  void init (Array& x, std::index_sequence<Is...>) {
+    if constexpr (std::is_same_v<Array, hx::dynarray<base_type, ndims>>)
+      ((extent[Is] = x.shape(Is)), ...);
+    else
+      ((extent[Is] = Array::template shape<Is>), ...);
+  }
+
+  /* offset(): in-memory offset of a view index. */
+  std::size_t offset (const index_type& idx) const {
+    std::size_t off = 0;
+    for (std::size_t d = 0; d < ndims; d++)
+      off += idx[d] * steps[d];
+
+    return off;
+  }
+
+  /* at(): element at the i'th row-major position of the view. */
+  base_type at (std::size_t i) const {
+    return ptr[offset(unpack(i, extent))];
+  }
+
+  /* unpack(): row-major index of the i'th position within @ext. */
+  static index_type unpack (std::size_t i, const index_type& ext) {
+    index_type idx;
+    for (std::size_t d = ndims; d > 0; d--) {
+      idx[d - 1] = i % ext[d - 1];
+      i /= ext[d - 1];
+    }
+
+    return idx;
+  }
+
+  /* next(): advance an index in row-major order within @ext. */
+  static void next (index_type& idx, const index_type& ext) {
+    for (std::size_t d = ndims; d > 0; d--) {
+      if (++idx[d - 1] < ext[d - 1])
+        return;
+
+      idx[d - 1] = 0;
+    }
+  }
+
+  /* grain(): number of elements of each task under parallel policies. */
+  std::size_t grain () const {
+    return hx::exec::grain<base_type>(extent[0] ? size() / extent[0] : 0);
+  }
+
+  /* count(): number of elements of a contiguous array operand. */
+  template<typename X>
+  static std::size_t count (const X& x) {
+    if constexpr (std::is_member_function_pointer_v<decltype(&X::size)>)
+      return x.size();
+    else
+      return X::size;
+  }
+
+  /* same_shape()
+   *
+   * Check that every view or dynarray operand of an expression has
+   * the shape of the view, and that every row-major array operand
+   * holds as many elements as the view.
+   */
+  template<typename T>
+  bool same_shape (const T& rhs) const {
+    if constexpr (hx::op::has_index_v<T, index_type>) {
+      return hx::op::all_leaves(rhs, [this] (const auto& leaf) {
+        for (std::size_t d = 0; d < ndims; d++)
+          if (leaf.shape(d) != extent[d])
+            return false;
+
+        return true;
+      });
+    }
+    else {
+      return hx::op::all_leaves(rhs, [this] (const auto& leaf) {
+        return count(leaf) == size();
+      });
+    }
+  }
+
+  /* update()
+   *
+   * Implementation of the assignment and compound assignment
+   * operators, visiting the view in row-major order. Operands of
+   * a different shape throw std::length_error.
+   */
+  template<typename T, typename Op>
+  const view& update (const T& rhs, const Op& op,
+                      hx::exec::policy p = hx::exec::seq) const {
+    if (!same_shape(rhs))
+      throw std::length_error("hx::view: operand shape mismatch");
+
+    if (size() == 0)
+      return *this;
+
+    hx::exec::for_range(p, size(), grain(),
+      [this, &rhs, &op] (std::size_t i0, std::size_t i1) {
+        index_type idx = unpack(i0, extent);
+        for (std::size_t i = i0; i < i1; i++, next(idx, extent)) {
+          base_type& x = ptr[offset(idx)];
+          if constexpr (!hx::op::is_indexable_v<T>)
+            op(x, rhs);
+          else if constexpr (hx::op::has_index_v<T, index_type>)
+            op(x, rhs[idx]);
+          else
+            op(x, hx::op::flat(rhs, i));
+        }
+      });
+
+    return *this;
+  }
+};
+
+/* is_array<view<Array>>
+ *
+ * Views accept the same element-wise operators
+ * and functions as hx::array.
+ */
+template<typename Array>
+struct is_array<hx::view<Array>> : public std::true_type {};
+
+/* namespace hx */ }
@@ -54,6 +54,20 @@ public:
     assert_values(x, {{1, 0, 3, 0, 0}});
   }
 
+  /* array op= value, array op= array, array op= expression */
+  void testCompoundAssignment () {
+    hx::array<int, 5> x{{1, 2, 3, 4, 5}}, y{{5, 4, 3, 2, 1}};
+    x += 1;
+    assert_values(x, {{2, 3, 4, 5, 6}});
+    x -= y;
+    assert_values(x, {{-3, -1, 1, 3, 5}});
+    x *= y + x;
+    assert_values(x, {{-6, -3, 4, 15, 30}});
+    x /= 2;
+    assert_values(x, {{-3, -1, 2, 7, 15}});
+    assert_values(y, {{5, 4, 3, 2, 1}});
+  }
+
   /* ~array */
   void testConjugate () {
     using T = hx::scalar<1>;
@@ -0,0 +1,50 @@
+
+#include "array.hh"
+
+class Alloc : public CxxTest::TestSuite {
+public:
+  /* make_array<X>() */
+  void testDefault () {
+    using X = hx::array<double, 64, 1024>;
+    auto x = hx::make_array<X>();
+    TS_ASSERT(x != nullptr);
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(x->raw_data());
+    TS_ASSERT_EQUALS(addr % hx::alloc::alignment, 0);
+    TS_ASSERT_EQUALS(x->max(), 0);
+
+    *x = 1.0;
+    TS_ASSERT_EQUALS(x->sum(hx::exec::par), X::size);
+  }
+
+  /* make_array<X>(flags) */
+  void testFlags () {
+    using X = hx::array<hx::scalar<1>, 512, 640>;
+    auto x = hx::make_array<X>(hx::alloc::huge |
+                               hx::alloc::numa_interleave |
+                               hx::alloc::uninit);
+    TS_ASSERT(x != nullptr);
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(x->raw_data());
+    TS_ASSERT_EQUALS(addr % hx::alloc::huge_page, 0);
+    TS_ASSERT_EQUALS(x->sum(), hx::scalar<1>{});
+
+    (*x)[511][639] = hx::scalar<1>{2, 3};
+    TS_ASSERT_EQUALS(x->sum(hx::exec::par), (hx::scalar<1>{2, 3}));
+  }
+
+  /* make_array<X>() through processing nodes */
+  void testNode () {
+    using X = hx::array<hx::scalar<1>, 16, 8>;
+    auto x = hx::make_array<X>();
+    *x = hx::scalar<1>{1, 0};
+
+    auto y = hx::proc::node(x).fft().abs()(x);
+    using Y = hx::array<double, 16, 8>;
+    TS_ASSERT((std::is_same_v<decltype(y), hx::alloc::unique_ptr<Y>>));
+    TS_ASSERT(y != nullptr);
+    TS_ASSERT_DELTA((*y)[0][3], 16, 1e-12);
+    TS_ASSERT_DELTA((*y)[1][3], 0, 1e-12);
+    TS_ASSERT_DELTA(y->sum(), 8 * 16, 1e-9);
+  }
+};
@@ -0,0 +1,88 @@
+
+#include "array.hh"
+
+class Copy : public CxxTest::TestSuite {
+public:
+  /* stream_copy() */
+  void testStream () {
+    std::vector<char> src(1000), dst(1000);
+    for (std::size_t i = 0; i < src.size(); i++)
+      src[i] = char(i * 7 + 3);
+
+    for (std::size_t a = 0; a < 16; a += 5) {
+      for (std::size_t b = 0; b < 16; b += 3) {
+        for (std::size_t n : {0, 15, 64, 200, 900}) {
+          std::fill(dst.begin(), dst.end(), 0);
+          hx::stream_copy(dst.data() + a, src.data() + b, n);
+          TS_ASSERT_EQUALS(std::memcmp(dst.data() + a, src.data() + b, n),
+                           0);
+          TS_ASSERT_EQUALS(dst[a + n], 0);
+        }
+      }
+    }
+  }
+
+  /* copy() */
+  void testCopy () {
+    using X = hx::array<hx::scalar<2>, 64, 48>;
+    auto x = std::make_unique<X>();
+    auto y = std::make_unique<X>();
+
+    double k = 0;
+    x->foreach([&k] (auto& v) { v[0] = k; v[3] = -k; k++; });
+
+    hx::copy(*y, *x, hx::exec::par);
+    assert_values(*x, *y);
+  }
+
+  /* copy_box() */
+  void testCopyBox () {
+    hx::array<int, 6, 7> x;
+    int k = 1;
+    x.foreach([&k] (int& v) { v = k++; });
+
+    /* crop. */
+    hx::array<int, 3, 4> y;
+    hx::copy_box(x, {2, 1}, y, {0, 0}, {3, 4});
+    for (std::size_t i = 0; i < 3; i++)
+      for (std::size_t j = 0; j < 4; j++)
+        TS_ASSERT_EQUALS(y[i][j], x[i + 2][j + 1]);
+
+    /* pad, filling outside the box. */
+    hx::dynarray<int, 2> z{{5, 9}};
+    z = -1;
+    hx::copy_box(y, {0, 1}, z, {1, 4}, {3, 3}, true, hx::exec::par);
+    for (std::size_t i = 0; i < 5; i++) {
+      for (std::size_t j = 0; j < 9; j++) {
+        const bool in = (i >= 1 && i < 4 && j >= 4 && j < 7);
+        TS_ASSERT_EQUALS((z[{i, j}]), in ? y[i - 1][j - 3] : 0);
+      }
+    }
+
+    /* insert, leaving the rest of the destination alone. */
+    z = -1;
+    hx::copy_box(y, {1, 0}, z, {3, 0}, {2, 4});
+    TS_ASSERT_EQUALS((z[{3, 0}]), y[1][0]);
+    TS_ASSERT_EQUALS((z[{4, 3}]), y[2][3]);
+    TS_ASSERT_EQUALS(z.sum(), y[1][0] + y[1][1] + y[1][2] + y[1][3] +
+                              y[2][0] + y[2][1] + y[2][2] + y[2][3] - 37);
+  }
+
+  /* copy_box() with empty boxes */
+  void testCopyEmptyBox () {
+    hx::array<int, 4, 4> a, b;
+    a = 1;
+    b = -1;
+    hx::copy_box(a, {0, 0}, b, {0, 0}, {4, 0});
+    hx::copy_box(a, {0, 0}, b, {0, 0}, {0, 4}, false, hx::exec::par);
+    TS_ASSERT_EQUALS(b.sum(), -16);
+
+    hx::copy_box(a, {0, 0}, b, {2, 2}, {4, 0}, true);
+    TS_ASSERT_EQUALS(b.max(), 0);
+    TS_ASSERT_EQUALS(b.min(), 0);
+
+    hx::dynarray<int, 2> z{{3, 0}};
+    hx::copy_box(a, {0, 0}, z, {0, 0}, {3, 0}, true, hx::exec::par);
+    TS_ASSERT_EQUALS(z.size(), 0);
+  }
+};
@@ -0,0 +1,127 @@
+
+#include "array.hh"
+
+class Dynamic : public CxxTest::TestSuite {
+public:
+  /* dynarray{sizes} */
+  void testConstructor () {
+    hx::dynarray<int, 3> x{{2, 3, 4}};
+    TS_ASSERT_EQUALS(x.size(), 24);
+    TS_ASSERT_EQUALS(x.shape(1), 3);
+    TS_ASSERT_EQUALS(x.stride(0), 12);
+    TS_ASSERT_EQUALS(x.stride(2), 1);
+    TS_ASSERT_EQUALS(x.max(), 0);
+
+    x[{1, 2, 3}] = 5;
+    TS_ASSERT_EQUALS(x.raw_data()[23], 5);
+    TS_ASSERT((hx::is_array_v<hx::dynarray<int, 3>>));
+  }
+
+  /* operator=(), operator+=(), ... */
+  void testExpressions () {
+    hx::dynarray<double, 2> x{{3, 5}}, y{{3, 5}};
+    double k = 0;
+    x.foreach([&k] (double& v) { v = k++; });
+
+    y = 2.0 * x + 1.0;
+    TS_ASSERT_EQUALS((y[{2, 4}]), 29);
+
+    y -= x;
+    y /= 2.0;
+    TS_ASSERT_EQUALS((y[{1, 1}]), 3.5);
+
+    y = hx::sqrt(x * x);
+    TS_ASSERT_EQUALS(y.sum(), x.sum());
+
+    y.assign(hx::exec::par, -x);
+    TS_ASSERT_EQUALS(y.min(), -14);
+  }
+
+  /* reduce(), sum(), prod() */
+  void testReduce () {
+    hx::dynarray<long, 1> x{{5000}};
+    long k = 0;
+    x.foreach([&k] (long& v) { v = ++k; });
+
+    TS_ASSERT_EQUALS(x.sum(), 5000 * 5001 / 2);
+    TS_ASSERT_EQUALS(x.sum(hx::exec::par), 5000 * 5001 / 2);
+    TS_ASSERT_EQUALS(x.max(hx::exec::par), 5000);
+    TS_ASSERT_EQUALS(x.reduce([] (long a, long b) { return a ^ b; }),
+                     x.reduce(hx::exec::par,
+                              [] (long a, long b) { return a ^ b; }));
+  }
+
+  /* foreach_vector() */
+  void testForEachVector () {
+    hx::dynarray<int, 3> x{{2, 3, 4}};
+    for (std::size_t d = 0; d < 3; d++) {
+      x.foreach_vector(d, [] (auto v) {
+        for (std::size_t i = 0; i < v.size(); i++)
+          v[i] += 1;
+      });
+    }
+
+    TS_ASSERT_EQUALS(x.min(), 3);
+    TS_ASSERT_EQUALS(x.max(), 3);
+  }
+
+  /* operands of mismatched shapes */
+  void testShapeMismatch () {
+    hx::dynarray<double, 1> x{{8}}, y{{4}}, z{{8}};
+    hx::dynarray<double, 2> a{{2, 4}}, b{{4, 2}};
+    x = 1.0;
+    y = 2.0;
+    z = 3.0;
+
+    TS_ASSERT_THROWS(x += y, const std::length_error&);
+    TS_ASSERT_THROWS(x = y, const std::length_error&);
+    TS_ASSERT_THROWS(x.assign(hx::exec::par, z + 2.0 * y),
+                     const std::length_error&);
+    TS_ASSERT_THROWS(a = b, const std::length_error&);
+    TS_ASSERT_EQUALS(x.sum(), 8);
+
+    TS_ASSERT_THROWS_NOTHING(x += z * 2.0 - z);
+    TS_ASSERT_EQUALS(x.sum(), 32);
+  }
+
+  /* hx::fft::dynamic */
+  void testTransform () {
+    using Type = hx::scalar<1>;
+    constexpr std::size_t n = 60;
+
+    hx::array<Type, n> a;
+    hx::dynarray<Type, 2> b{{3, n}};
+    for (std::size_t i = 0; i < n; i++) {
+      a[i] = Type{double(i % 7), double(i % 3)};
+      for (std::size_t r = 0; r < 3; r++)
+        b[{r, i}] = a[i];
+    }
+
+    hx::fft::forward<Type, n> f;
+    f(a.raw_data());
+
+    hx::fft::dynamic<Type, hx::fft::fwd> g(n);
+    TS_ASSERT(g.valid());
+    b.foreach_vector(hx::exec::par, 1, [&g] (auto v) {
+      g(v.data(), v.stride());
+    });
+
+    for (std::size_t i = 0; i < n; i++) {
+      TS_ASSERT_EQUALS((b[{0, i}]), a[i]);
+      TS_ASSERT_EQUALS((b[{2, i}]), a[i]);
+    }
+  }
+
+  /* hx::fft::dynamic with unsupported lengths */
+  void testInvalidTransform () {
+    using Type = hx::scalar<1>;
+    for (std::size_t n : {0, 1, 7, 14, 77}) {
+      const hx::fft::dynamic<Type, hx::fft::fwd> g(n);
+      TS_ASSERT(!g.valid());
+
+      std::vector<Type> x(n + 1, Type{1.0, 2.0});
+      TS_ASSERT(!g(x.data()));
+      TS_ASSERT_EQUALS(x[0], (Type{1.0, 2.0}));
+    }
+  }
+};
@@ -0,0 +1,83 @@
+
+#include "array.hh"
+
+class Mapped : public CxxTest::TestSuite {
+public:
+  /* mapped_array<Type, Dims...> */
+  void testMapped () {
+    using M = hx::mapped_array<double, 8, 16>;
+    constexpr std::size_t header = 64;
+
+    /* write a headered file through a read-write mapping. */
+    std::FILE* fh = std::tmpfile();
+    TS_ASSERT(fh != nullptr);
+    const int fd = fileno(fh);
+    {
+      M x;
+      TS_ASSERT(x.open(fd, hx::map::read_write, header));
+      TS_ASSERT(x.advise(hx::map::sequential));
+
+      double k = 0;
+      x->foreach([&k] (double& v) { v = k++; });
+      TS_ASSERT(x.sync());
+    }
+
+    double v = 0;
+    TS_ASSERT_EQUALS(::pread(fd, &v, sizeof(v), header + 5 * 8),
+                     ssize_t(sizeof(v)));
+    TS_ASSERT_EQUALS(v, 5);
+
+    /* read the file back. */
+    hx::mapped_array<const double, 8, 16> y;
+    TS_ASSERT(!M().open(fd, hx::map::read_only, header));
+    TS_ASSERT(!y.open(fd, hx::map::read_write, header));
+    TS_ASSERT(y.open(fd, hx::map::read_only, header));
+    TS_ASSERT(y.advise(hx::map::willneed));
+    TS_ASSERT_EQUALS(y->sum(), 127 * 128 / 2);
+    TS_ASSERT_EQUALS(((*y)[{3, 4}]), 52);
+
+    /* private writes are not stored in the file. */
+    M z;
+    TS_ASSERT(z.open(fd, hx::map::copy_on_write, header));
+    *z = 0.0;
+    TS_ASSERT_EQUALS(z->sum(), 0);
+    TS_ASSERT_EQUALS(y->sum(), 127 * 128 / 2);
+
+    /* files that are too short are not mapped read-only. */
+    hx::mapped_array<const double, 8, 16> w;
+    TS_ASSERT(!w.open(fd, hx::map::read_only, 4096));
+    TS_ASSERT(!w.is_open());
+    std::fclose(fh);
+  }
+
+  /* mapped_array<const Type, Dims...> as a node source */
+  void testNode () {
+    using Type = hx::scalar<1>;
+    using X = hx::array<Type, 16, 8>;
+
+    std::FILE* fh = std::tmpfile();
+    TS_ASSERT(fh != nullptr);
+    if (!fh)
+      return;
+
+    const int fd = fileno(fh);
+    {
+      hx::mapped_array<Type, 16, 8> x;
+      TS_ASSERT(x.open(fd, hx::map::read_write));
+      *x = Type{1, 0};
+    }
+
+    hx::mapped_array<const Type, 16, 8> y;
+    TS_ASSERT(y.open(fd));
+    TS_ASSERT((std::is_same_v<decltype(*y), const X&>));
+
+    auto z = hx::proc::node(y.ptr()).fft().abs()(y.ptr());
+    TS_ASSERT_DELTA((*z)[0][3], 16, 1e-12);
+    TS_ASSERT_DELTA(z->sum(), 16 * 8, 1e-9);
+
+    auto p = y.release();
+    TS_ASSERT(!y.is_open());
+    TS_ASSERT_EQUALS(((*p)[{15, 7}]), (Type{1, 0}));
+    std::fclose(fh);
+  }
+};
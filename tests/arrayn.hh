@@ -55,6 +55,68 @@ public:
     assert_values(x, {{1, 0, 0, 0, 5, 6}});
   }
 
+  /* array op= array [aliased] */
+  void testCompoundAssignment () {
+    using T = hx::scalar<1>;
+    using A = hx::array<T, 2, 2>;
+    T xdata[4] = { {1, 2}, {3, 4}, {5, 6}, {7, 8} };
+    T ydata[4] = { {-3, 4}, {-7, 24}, {-11, 60}, {-15, 112} };
+    T zdata[4] = { {2, 0}, {0, 4}, {-8, 0}, {0, -1} };
+    A x{xdata}, y{zdata};
+    x *= x;
+    assert_values(x, A{ydata});
+    x -= x * 2.0 - x;
+    assert_values(x, {{T{}, T{}, T{}, T{}}});
+    y /= y;
+    assert_values(y, {{T{1, 0}, T{1, 0}, T{1, 0}, T{1, 0}}});
+  }
+
+  /* norm(array), conj(array), soft_threshold(array) */
+  void testLazyFunctions () {
+    using T = hx::scalar<1>;
+    using A = hx::array<T, 2, 2>;
+    T xdata[4] = { {3, 4}, {0, -1}, {6, 8}, {-3, 4} };
+    T ydata[4] = { {3, -4}, {0, 1}, {6, -8}, {-3, -4} };
+    T zdata[4] = { {3, 4}, {0, 0}, {9, 12}, {-3, 4} };
+    A x{xdata}, y, z;
+    hx::array<double, 2, 2> n;
+    n = hx::norm(x);
+    assert_values(n, {{5, 1, 10, 5}});
+    n = hx::squaredNorm(x + x);
+    assert_values(n, {{100, 4, 400, 100}});
+    y = hx::conj(x, 1);
+    assert_values(y, A{ydata});
+    z = hx::soft_threshold(x + x, 5);
+    assert_values(z, A{zdata});
+  }
+
+  /* reduce(expression), sum(), dot(), max_norm(), argmax_norm() */
+  void testExpressionReductions () {
+    using T = hx::scalar<1>;
+    using A = hx::array<T, 2, 3>;
+    T xdata[6] = { {1, 0}, {0, 2}, {3, 4}, {-1, 1}, {0, -6}, {2, 2} };
+    A x{xdata};
+    hx::array<int, 2, 3> y{{1, 2, 3, 4, 5, 6}}, z{{6, 5, 4, 3, 2, 1}};
+
+    TS_ASSERT_EQUALS(hx::sum(y - z), 0);
+    TS_ASSERT_EQUALS(hx::sum(y * 2, hx::exec::par), 42);
+    TS_ASSERT_EQUALS(hx::dot(y, z), 56);
+    TS_ASSERT_EQUALS(hx::dot(y, -z, hx::exec::par_simd), -56);
+    TS_ASSERT_EQUALS(hx::reduce(y + z,
+      [] (int a, int b) { return a > b ? a : b; }), 7);
+
+    TS_ASSERT_DELTA(hx::sum(hx::norm(x)),
+                    14 + std::sqrt(2) + std::sqrt(8), 1e-12);
+    TS_ASSERT_EQUALS(hx::max_norm(x), 6);
+    TS_ASSERT_EQUALS(hx::max_norm(x - x * 2.0, hx::exec::par), 6);
+    TS_ASSERT_EQUALS(hx::max_norm(x), x.max().norm());
+
+    const auto idx = hx::argmax_norm(x, hx::exec::par);
+    TS_ASSERT_EQUALS(idx[0], 1);
+    TS_ASSERT_EQUALS(idx[1], 1);
+    TS_ASSERT_EQUALS(hx::argmax_norm(z)[1], 0);
+  }
+
   /* ~array */
   void testConjugate () {
     using T = hx::scalar<1>;
@@ -181,6 +243,41 @@ public:
     TS_ASSERT_EQUALS(x.prod(), 720);
   }
 
+  /* reduce<dim>(), sum<dim>(), max<dim>(), max_norm<dim>() */
+  void testProjections () {
+    hx::array<int, 2, 3, 4> x;
+    int k = 0;
+    x.foreach([&k] (int& v) { v = (k % 5 == 0 ? -k : k); k++; });
+
+    auto s0 = x.sum<0>();
+    auto s1 = x.sum<1>();
+    auto s2 = x.sum<2>();
+    hx::index<2, 3, 4> idx;
+    do {
+      int t0 = 0, t1 = 0, t2 = 0;
+      for (std::size_t i = 0; i < 2; i++) t0 += x[{i, idx[1], idx[2]}];
+      for (std::size_t i = 0; i < 3; i++) t1 += x[{idx[0], i, idx[2]}];
+      for (std::size_t i = 0; i < 4; i++) t2 += x[{idx[0], idx[1], i}];
+      TS_ASSERT_EQUALS((*s0)[idx[1]][idx[2]], t0);
+      TS_ASSERT_EQUALS((*s1)[idx[0]][idx[2]], t1);
+      TS_ASSERT_EQUALS((*s2)[idx[0]][idx[1]], t2);
+    }
+    while (idx++);
+
+    auto m1 = x.max<1>();
+    TS_ASSERT_EQUALS((*m1)[0][0], 8);
+    TS_ASSERT_EQUALS((*m1)[1][0], 16);
+    TS_ASSERT_EQUALS((*m1)[1][3], 23);
+
+    auto n2 = x.max_norm<2>();
+    TS_ASSERT_DELTA((*n2)[1][0], 15, 1e-12);
+    TS_ASSERT_DELTA((*n2)[1][2], 23, 1e-12);
+
+    auto p0 = x.reduce<0>([] (int a, int b) { return a * b; });
+    TS_ASSERT_EQUALS((*p0)[0][1], 13);
+    TS_ASSERT_EQUALS((*p0)[2][3], 253);
+  }
+
   /* foreach_vector() */
   void testForEachVector () {
     hx::array<int, 3, 3> x;
@@ -0,0 +1,122 @@
+
+#include "array.hh"
+
+class Planar : public CxxTest::TestSuite {
+public:
+  /* planar[idx], planar[idx][k] */
+  void testElements () {
+    using X = hx::planar<2, 3, 4>;
+    auto x = std::make_unique<X>();
+    *x = 0.0;
+
+    X::index_type idx;
+    double k = 0;
+    do {
+      hx::scalar<2> v;
+      v[0] = k;
+      v[3] = -k;
+      (*x)[idx] = v;
+      k++;
+    }
+    while (idx++);
+
+    const X& cx = *x;
+    TS_ASSERT_EQUALS(X::planes, 4);
+    TS_ASSERT_EQUALS((cx[{1, 2}][0]), 6);
+    TS_ASSERT_EQUALS((cx[{1, 2}][3]), -6);
+    TS_ASSERT_EQUALS(x->real()[2][3], 11);
+    TS_ASSERT_EQUALS(x->plane(3)[2][3], -11);
+    TS_ASSERT_EQUALS(x->plane(1).sum(), 0);
+
+    auto re = std::make_unique<hx::array<double, 3, 4>>();
+    hx::proc::real<X>{}(x, re);
+    TS_ASSERT_EQUALS((*re)[1][2], 6);
+
+    (*x)[{0, 1}][2] = 5;
+    (*x)[{0, 1}] += 1.0;
+    TS_ASSERT_EQUALS(x->plane(2)[0][1], 5);
+    TS_ASSERT_EQUALS(x->real()[0][1], 2);
+  }
+
+  /* planar = array, array = planar */
+  void testConvert () {
+    using A = hx::array<hx::scalar<3>, 8, 16>;
+    using X = hx::planar<3, 8, 16>;
+    auto a = std::make_unique<A>();
+    auto b = std::make_unique<A>();
+    auto x = std::make_unique<X>();
+
+    double k = 0;
+    a->foreach([&k] (hx::scalar<3>& v) {
+      for (std::size_t i = 0; i < 8; i++)
+        v[i] = k + i;
+      k++;
+    });
+
+    x->assign(hx::exec::par, *a * 2.0);
+    b->assign(hx::exec::par, *x - *a);
+    TS_ASSERT_EQUALS(x->plane(7)[1][0], 2 * (16 + 7));
+    TS_ASSERT_EQUALS(b->raw_data()[37], a->raw_data()[37]);
+    TS_ASSERT(std::memcmp(b->raw_data(), a->raw_data(), sizeof(A)) == 0);
+  }
+
+  /* planar.norms() */
+  void testNorms () {
+    using X = hx::planar<1, 10, 10>;
+    auto x = std::make_unique<X>();
+    hx::array<double, 10, 10> n;
+
+    *x = hx::scalar<1>{3.0, 4.0};
+    x->norms(n, hx::exec::par);
+    TS_ASSERT_EQUALS(n.sum(), 500);
+  }
+
+  /* hx::proc::node with planar input */
+  void testNode () {
+    using X = hx::planar<2, 4, 6>;
+    auto x = std::make_unique<X>();
+    *x = hx::scalar<2>{3.0, 0.0, 0.0, 4.0};
+    (*x)[{1, 2}] = hx::scalar<2>{-6.0, 0.0, 8.0, 0.0};
+
+    auto y = hx::proc::node(x).abs()(x);
+    TS_ASSERT_EQUALS((*y)[0][0], 5);
+    TS_ASSERT_EQUALS((*y)[1][2], 10);
+    TS_ASSERT_EQUALS(y->sum(), 5 * 23 + 10);
+
+    auto z = hx::proc::node(x).real()(x);
+    TS_ASSERT_EQUALS((*z)[3][5], 3);
+    TS_ASSERT_EQUALS((*z)[1][2], -6);
+  }
+
+  /* planar.foreach_vector(), node.fft() */
+  void testVectors () {
+    using Type = hx::scalar<2>;
+    using A = hx::array<Type, 12, 16>;
+    using X = hx::planar<2, 12, 16>;
+    auto a = std::make_unique<A>();
+    auto x = std::make_unique<X>();
+
+    double k = 0;
+    a->foreach([&k] (Type& v) { v = Type{k, 1, -0.5 * k, 2}; k++; });
+    x->assign(hx::exec::par, *a);
+
+    auto y = hx::proc::node(x).template fft<0>()(x);
+    auto z = hx::proc::node(x).template fftn<0, 1>()(x);
+
+    hx::fft::forward<Type, 12, 1> f0;
+    hx::fft::forward<Type, 16, 2> f1;
+    a->foreach_vector<0>([&f0] (auto v) { f0(v); });
+    TS_ASSERT(std::memcmp(y->raw_data(), a->raw_data(), sizeof(A)) == 0);
+
+    a->foreach_vector<1>([&f1] (auto v) { f1(v); });
+    x->foreach_vector<0>([&f0] (auto v) { f0(v); });
+    x->foreach_vector<1>([&f1] (auto v) { f1(v); });
+
+    A::index_type idx;
+    do {
+      TS_ASSERT_EQUALS(Type((*x)[idx]), (*a)[idx]);
+      TS_ASSERT_DELTA(((*z)[idx] - (*a)[idx]).norm(), 0, 1e-9);
+    }
+    while (idx++);
+  }
+};
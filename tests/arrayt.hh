@@ -0,0 +1,104 @@
+
+#include "array.hh"
+
+class Tiled : public CxxTest::TestSuite {
+public:
+  /* tiled[idx] */
+  void testLayout () {
+    using X = hx::tiled<int, 4, 8, 8, 2>;
+    TS_ASSERT_EQUALS((X::edge<0>), 4);
+    TS_ASSERT_EQUALS((X::edge<2>), 2);
+    TS_ASSERT_EQUALS(X::volume, 32);
+    TS_ASSERT_EQUALS((X::inner_stride<0>), 8);
+    TS_ASSERT_EQUALS((X::tile_stride<0>), 64);
+    TS_ASSERT_EQUALS((X::tile_stride<1>), 32);
+
+    auto x = std::make_unique<X>();
+    X::index_type idx;
+    int k = 0;
+    do {
+      (*x)[idx] = k++;
+    }
+    while (idx++);
+
+    const int* d = x->storage_data();
+    TS_ASSERT_EQUALS(d[0], 0);
+    TS_ASSERT_EQUALS(d[1], 1);
+    TS_ASSERT_EQUALS(d[2], 2);
+    TS_ASSERT_EQUALS(d[8], 16);
+    TS_ASSERT_EQUALS(d[32], 8);
+    TS_ASSERT_EQUALS(d[64], 64);
+    TS_ASSERT_EQUALS(x->sum(), 127 * 128 / 2);
+
+    hx::array<int, 8, 8, 2> a;
+    a.assign(hx::exec::seq, *x);
+    TS_ASSERT_EQUALS(a[5][4][1], 5 * 16 + 4 * 2 + 1);
+
+    auto y = std::make_unique<X>();
+    y->assign(hx::exec::par, a + *x);
+    *y -= *x;
+    TS_ASSERT_EQUALS(((*y)[{7, 5, 1}]), 123);
+    TS_ASSERT_EQUALS(y->max(), 127);
+  }
+
+  /* foreach_vector() on tiled arrays */
+  void testVectors () {
+    using Type = hx::scalar<1>;
+    using A = hx::array<Type, 16, 12>;
+    using X = hx::tiled<Type, 4, 16, 12>;
+    auto a = std::make_unique<A>();
+    auto x = std::make_unique<X>();
+
+    double k = 0;
+    a->foreach([&k] (Type& v) { v = Type{k, -0.5 * k}; k++; });
+    x->assign(hx::exec::par, *a);
+
+    hx::fft::forward<Type, 16> f0;
+    hx::fft::forward<Type, 12> f1;
+    a->foreach_vector<0>([&f0] (auto v) { f0(v); });
+    a->foreach_vector<1>([&f1] (auto v) { f1(v); });
+    x->foreach_vector<0>([&f0] (auto v) { f0(v); });
+    x->foreach_vector<1>([&f1] (auto v) { f1(v); });
+
+    A::index_type idx;
+    do {
+      TS_ASSERT_EQUALS((*x)[idx], (*a)[idx]);
+    }
+    while (idx++);
+
+    hx::vector<X, 1> v{*x, {3, 5}};
+    TS_ASSERT_EQUALS(v[0], (*a)[3][5]);
+    TS_ASSERT_EQUALS((v + 4)[0], (*a)[3][9]);
+    TS_ASSERT((v.data() == &(*x)[{3, 5}]));
+  }
+
+  /* tiled arrays are not row-major operands */
+  void testRowMajor () {
+    using A = hx::array<int, 4, 4>;
+    using X = hx::tiled<int, 2, 4, 4>;
+    TS_ASSERT(!hx::op::has_raw_data_v<X>);
+    TS_ASSERT(!hx::op::is_flat_v<X>);
+    TS_ASSERT(!hx::view<A>::is_operand<X>);
+
+    auto x = std::make_unique<X>();
+    X::index_type idx;
+    int k = 0;
+    do {
+      (*x)[idx] = k++;
+    }
+    while (idx++);
+
+    hx::vector<X, 1> v{*x};
+    TS_ASSERT_EQUALS(v[2], 2);
+
+    A a, b, c;
+    a.assign(hx::exec::seq, *x);
+    b = 0;
+    c = 0;
+    hx::copy_box(a, {0, 0}, b, {0, 0}, {4, 4});
+    hx::view<A>{c} = a;
+    TS_ASSERT_EQUALS(b[0][2], 2);
+    TS_ASSERT_EQUALS(c[0][2], 2);
+    TS_ASSERT_EQUALS(c[2][1], 9);
+  }
+};
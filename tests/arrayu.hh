@@ -95,5 +95,35 @@ public:
     constexpr auto ab = std::is_same_v<A, B>;
     TS_ASSERT_EQUALS(ab, true);
   }
+
+  /* is_flat_v */
+  void testFlat () {
+    using A = hx::array<hx::scalar<1>, 3, 4, 5>;
+    auto x = std::make_unique<A>();
+    auto y = std::make_unique<A>();
+    auto z = std::make_unique<A>();
+
+    using E = decltype(*x - *y / 2.0 + ~*x);
+    TS_ASSERT_EQUALS(hx::op::is_flat_v<E>, true);
+
+    std::size_t i = 0;
+    A::index_type idx;
+    do {
+      (*x)[idx] = hx::scalar<1>{double(i), 1};
+      (*y)[idx] = hx::scalar<1>{2, double(i % 3)};
+      i++;
+    }
+    while (idx++);
+
+    *z = *x - *y / 2.0 + ~*x;
+
+    bool same = true;
+    do {
+      same = same && ((*z)[idx] == (*x)[idx] - (*y)[idx] / 2.0 + ~(*x)[idx]);
+    }
+    while (idx++);
+
+    TS_ASSERT(same);
+  }
 };
 
@@ -0,0 +1,151 @@
+
+#include "array.hh"
+
+class View : public CxxTest::TestSuite {
+public:
+  /* view.slice() */
+  void testSlice () {
+    hx::array<int, 4, 6> x;
+    int k = 0;
+    x.foreach([&k] (int& v) { v = k++; });
+
+    auto v = hx::view(x).slice(0, 1, 3).slice(1, 2, 6, 2);
+    TS_ASSERT_EQUALS(v.size(), 4);
+    TS_ASSERT_EQUALS(v.shape(1), 2);
+    TS_ASSERT_EQUALS(v.stride(1), 2);
+    TS_ASSERT_EQUALS((v[{0, 0}]), 8);
+    TS_ASSERT_EQUALS((v[{0, 1}]), 10);
+    TS_ASSERT_EQUALS((v[{1, 1}]), 16);
+    TS_ASSERT_EQUALS(v.sum(), 8 + 10 + 14 + 16);
+
+    v = 0;
+    TS_ASSERT_EQUALS(x.sum(), 23 * 24 / 2 - (8 + 10 + 14 + 16));
+    TS_ASSERT_EQUALS(x[1][3], 9);
+  }
+
+  /* view.permute() */
+  void testPermute () {
+    hx::dynarray<int, 2> x{{2, 3}}, y{{3, 2}};
+    int k = 0;
+    x.foreach([&k] (int& v) { v = k++; });
+
+    const hx::view vy{y};
+    vy = hx::view(x).permute({1, 0});
+    for (std::size_t i = 0; i < 3; i++)
+      for (std::size_t j = 0; j < 2; j++)
+        TS_ASSERT_EQUALS((y[{i, j}]), (x[{j, i}]));
+  }
+
+  /* view = expression, view += expression */
+  void testExpressions () {
+    hx::array<double, 5, 5> a, b;
+    double k = 0;
+    a.foreach([&k] (double& v) { v = k++; });
+    b = 0.0;
+
+    const auto va = hx::view(a).slice(0, 1, 4).slice(1, 1, 4);
+    const auto vb = hx::view(b).slice(0, 0, 3).slice(1, 2, 5);
+    vb = 2.0 * va + 1.0;
+    TS_ASSERT_EQUALS(b[0][2], 13);
+    TS_ASSERT_EQUALS(b[2][4], 37);
+    TS_ASSERT_EQUALS(b[3][4], 0);
+
+    vb -= va;
+    TS_ASSERT_EQUALS(b[1][3], 13);
+
+    hx::array<double, 9> c;
+    c.foreach([] (double& v) { v = 1; });
+    vb.assign(hx::exec::par, c);
+    TS_ASSERT_EQUALS(b.sum(), 9);
+  }
+
+  /* view.foreach_vector() with hx::fft::dynamic */
+  void testTransform () {
+    using Type = hx::scalar<1>;
+    constexpr std::size_t n = 30;
+
+    hx::dynarray<Type, 2> x{{4, 2 * n}};
+    hx::array<Type, n> ref;
+    for (std::size_t i = 0; i < 2 * n; i++)
+      for (std::size_t r = 0; r < 4; r++)
+        x[{r, i}] = Type{double(i % 5), double(i % 2)};
+
+    for (std::size_t i = 0; i < n; i++)
+      ref[i] = x[{0, 2 * i}];
+
+    hx::fft::forward<Type, n> f;
+    f(ref.raw_data());
+
+    const hx::fft::dynamic<Type, hx::fft::fwd> g(n);
+    hx::view(x).slice(0, 1, 3).slice(1, 0, 2 * n, 2)
+      .foreach_vector(1, [&g] (auto v) { g(v.data(), v.stride()); });
+
+    for (std::size_t i = 0; i < n; i++) {
+      TS_ASSERT_EQUALS((x[{1, 2 * i}]), ref[i]);
+      TS_ASSERT_EQUALS((x[{2, 2 * i}]), ref[i]);
+      TS_ASSERT_EQUALS((x[{3, 2 * i}]), (x[{0, 2 * i}]));
+    }
+  }
+
+  /* view = mismatched operand */
+  void testShapeMismatch () {
+    hx::array<double, 4, 4> a;
+    hx::array<double, 6> c;
+    a = 1.0;
+    c = 2.0;
+
+    const auto va = hx::view(a);
+    const auto vs = va.slice(0, 0, 2);
+    TS_ASSERT_THROWS(va = vs, const std::length_error&);
+    TS_ASSERT_THROWS(va += 2.0 * vs, const std::length_error&);
+    TS_ASSERT_THROWS(vs.assign(hx::exec::par, c), const std::length_error&);
+    TS_ASSERT_THROWS_NOTHING(va.slice(0, 2, 4) = vs);
+    TS_ASSERT_EQUALS(a.sum(), 16);
+  }
+
+  /* view.slice() with invalid ranges */
+  void testInvalidSlice () {
+    hx::array<double, 4, 4> a;
+    const auto va = hx::view(a);
+    TS_ASSERT_THROWS(va.slice(0, 0, 4, 0), const std::invalid_argument&);
+    TS_ASSERT_THROWS(va.slice(1, 3, 2), const std::invalid_argument&);
+    TS_ASSERT_THROWS(va.slice(1, 0, 5), const std::invalid_argument&);
+    TS_ASSERT_THROWS(va.slice(2, 0, 1), const std::invalid_argument&);
+    TS_ASSERT_EQUALS(va.slice(1, 1, 4, 2).shape(1), 2);
+  }
+
+  /* view = expression of arrays */
+  void testArrayExpression () {
+    hx::array<double, 4, 4> a;
+    hx::array<double, 8> c;
+    hx::array<double, 6> e;
+    a = 0.0;
+    c.foreach([] (double& v) { v = 1; });
+    e.foreach([] (double& v) { v = 1; });
+
+    const auto vs = hx::view(a).slice(0, 1, 3);
+    vs = 2.0 * c + c;
+    TS_ASSERT_EQUALS(a[1][2], 3);
+    TS_ASSERT_EQUALS(a.sum(), 24);
+    TS_ASSERT_THROWS(vs = c + 2.0 * e, const std::length_error&);
+  }
+
+  /* empty views */
+  void testEmpty () {
+    hx::dynarray<double, 2> x{{3, 4}};
+    x = 1.0;
+
+    const auto v = hx::view(x).slice(0, 2, 2);
+    TS_ASSERT_EQUALS(v.size(), 0);
+    TS_ASSERT_EQUALS(v.sum(), 0);
+    TS_ASSERT_EQUALS(v.sum(hx::exec::par), 0);
+
+    std::size_t n = 0;
+    v = 5.0;
+    v.foreach(hx::exec::par, [&n] (double&) { n++; });
+    v.foreach_vector(hx::exec::par, 0, [&n] (auto) { n++; });
+    v.foreach_vector(1, [&n] (auto) { n++; });
+    TS_ASSERT_EQUALS(n, 0);
+    TS_ASSERT_EQUALS(x.sum(), 12);
+  }
+};
@@ -0,0 +1,99 @@
+
+#include "../hx/core.hh"
+#include <cxxtest/TestSuite.h>
+
+class Conv : public CxxTest::TestSuite {
+public:
+  /* conv: short kernels use the direct method. */
+  void testMethod () {
+    using T = hx::scalar<1>;
+    TS_ASSERT_EQUALS((hx::conv<T, 64, 3>::mode), hx::fir::direct);
+    TS_ASSERT_EQUALS((hx::conv<T, 4096, 500>::mode), hx::fir::overlap_save);
+  }
+
+  /* conv: direct, overlap-add and overlap-save */
+  void testConvDirect () { ttest<hx::conv, 50, 7, hx::fir::direct>(); }
+  void testConvAdd () { ttest<hx::conv, 50, 7, hx::fir::overlap_add>(); }
+  void testConvSave () { ttest<hx::conv, 50, 7, hx::fir::overlap_save>(); }
+  void testConvLong () { ttest<hx::conv, 64, 100, hx::fir::overlap_add>(); }
+  void testConvAuto () { ttest<hx::conv, 300, 120, hx::fir::automatic>(); }
+
+  /* xcorr: direct, overlap-add and overlap-save */
+  void testCorrDirect () { ttest<hx::xcorr, 50, 7, hx::fir::direct>(); }
+  void testCorrAdd () { ttest<hx::xcorr, 50, 7, hx::fir::overlap_add>(); }
+  void testCorrSave () { ttest<hx::xcorr, 50, 7, hx::fir::overlap_save>(); }
+  void testCorrLong () { ttest<hx::xcorr, 64, 100, hx::fir::overlap_save>(); }
+  void testCorrAuto () { ttest<hx::xcorr, 300, 120, hx::fir::automatic>(); }
+
+  /* conv along the second dimension of an array. */
+  void testArray () {
+    using T = hx::scalar<2>;
+    using X = hx::array<T, 3, 40>;
+    auto x = std::make_unique<X>();
+    auto y = std::make_unique<X>();
+    hx::array<T, 12> h;
+
+    for (std::size_t k = 0; k < 12; k++)
+      h[k] = T{1.0 / (k + 1), 0, 0.5, double(k % 3)};
+
+    for (std::size_t i = 0; i < 3; i++)
+      for (std::size_t j = 0; j < 40; j++)
+        (*x)[i][j] = (*y)[i][j] = T{double(i), double(j % 4), 1, 0};
+
+    x->foreach_vector<1>(hx::conv<T, 40, 12, 2, hx::fir::direct>{h});
+    y->foreach_vector<1>(hx::conv<T, 40, 12, 2, hx::fir::overlap_save>{h});
+
+    double err = 0;
+    for (std::size_t i = 0; i < 3; i++)
+      for (std::size_t j = 0; j < 40; j++)
+        err += ((*x)[i][j] - (*y)[i][j]).squaredNorm();
+
+    TS_ASSERT_DELTA(err, 0, 1e-20);
+  }
+
+private:
+  /* ttest<Filter, N, K, Method>()
+   *
+   * Template function for comparing filters of length-N vectors
+   * with K-point kernels against their defining sums.
+   */
+  template<template<typename, std::size_t, std::size_t, std::size_t,
+                    hx::fir::method> typename Filter,
+           std::size_t N, std::size_t K, hx::fir::method Method>
+  static inline void ttest () {
+    using T = hx::scalar<1>;
+    constexpr bool corr = std::is_same_v<Filter<T, N, K, 1, Method>,
+                                         hx::xcorr<T, N, K, 1, Method>>;
+
+    /* initialize the kernel and data. */
+    hx::array<T, K> h;
+    hx::array<T, N> x, y;
+    for (std::size_t k = 0; k < K; k++)
+      h[k] = T{double(k % 5) - 2, 1.0 / (k + 1)};
+
+    for (std::size_t n = 0; n < N; n++)
+      x[n] = T{double(n % 7), double(n % 3) - 1};
+
+    /* compute the reference result. */
+    for (std::size_t n = 0; n < N; n++) {
+      T sum{};
+      for (std::size_t k = 0; k < K; k++) {
+        if (!corr && n >= k)
+          sum += h[k] * x[n - k];
+        else if (corr && n + k < N)
+          sum += x[n + k] * ~h[k];
+      }
+      y[n] = sum;
+    }
+
+    /* filter in-place and check the result. */
+    Filter<T, N, K, 1, Method> f{h};
+    f(x.raw_data());
+
+    double err = 0;
+    for (std::size_t n = 0; n < N; n++)
+      err += (x[n] - y[n]).squaredNorm();
+
+    TS_ASSERT_DELTA(err, 0, 1e-18);
+  }
+};
@@ -0,0 +1,209 @@
+
+#include "../hx/core.hh"
+#include <cxxtest/TestSuite.h>
+
+class Exec : public CxxTest::TestSuite {
+public:
+  /* pool::run() */
+  void testPool () {
+    hx::exec::pool p{4};
+    TS_ASSERT_EQUALS(p.size(), 4);
+
+    /* every task runs exactly once, including uneven ones. */
+    for (std::size_t n : {0, 1, 3, 17, 1000}) {
+      std::vector<std::atomic<int>> count(n);
+      p.run(n, [&count] (std::size_t t) {
+        if (t % 7 == 0)
+          std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+        count[t]++;
+      });
+
+      for (std::size_t t = 0; t < n; t++)
+        TS_ASSERT_EQUALS(count[t].load(), 1);
+    }
+  }
+
+  /* configure(), shared() */
+  void testConfigure () {
+    hx::exec::configure(3, true);
+    TS_ASSERT_EQUALS(hx::exec::shared().size(), 3);
+
+    std::atomic<std::size_t> sum{0};
+    hx::exec::for_range(hx::exec::par, 1000, 7,
+      [&sum] (std::size_t i0, std::size_t i1) {
+        for (std::size_t i = i0; i < i1; i++)
+          sum += i;
+      });
+
+    TS_ASSERT_EQUALS(sum.load(), 499500);
+    hx::exec::configure(4);
+  }
+
+  /* nested parallel calls */
+  void testNested () {
+    std::atomic<std::size_t> sum{0};
+    hx::exec::for_range(hx::exec::par, 64, 1,
+      [&sum] (std::size_t i0, std::size_t i1) {
+        hx::exec::for_range(hx::exec::par, 1000, 7,
+          [&sum] (std::size_t j0, std::size_t j1) {
+            for (std::size_t j = j0; j < j1; j++)
+              sum += j;
+          });
+      });
+
+    TS_ASSERT_EQUALS(sum.load(), 64 * 499500);
+
+    /* a parallel assignment within a parallel vector loop. */
+    hx::dynarray<double, 2> x{{8, 4096}};
+    x = 1.0;
+    x.foreach_vector(hx::exec::par, 0, [] (auto v) {
+      hx::dynarray<double, 1> y{{1 << 16}};
+      y.assign(hx::exec::par, v[0] + 1.0);
+      v[0] = y.sum();
+    });
+
+    TS_ASSERT_EQUALS(x.sum(), 4096.0 * (7 + 2 * (1 << 16)));
+  }
+
+  /* exceptions thrown by tasks */
+  void testException () {
+    hx::exec::pool p{4};
+    bool caught = false;
+    try {
+      p.run(100, [] (std::size_t t) {
+        if (t == 42)
+          throw std::runtime_error("task");
+      });
+    }
+    catch (const std::runtime_error&) {
+      caught = true;
+    }
+
+    TS_ASSERT(caught);
+
+    std::atomic<std::size_t> count{0};
+    p.run(100, [&count] (std::size_t t) { count++; });
+    TS_ASSERT_EQUALS(count.load(), 100);
+  }
+
+  /* array.assign(policy, ...), array.foreach(policy, ...) */
+  void testAssign () {
+    using A = hx::array<int, 256, 512>;
+    auto x = std::make_unique<A>();
+    auto y = std::make_unique<A>();
+    auto z = std::make_unique<A>();
+
+    int k = 0;
+    x->foreach([&k] (int& v) { v = k++; });
+
+    y->assign(hx::exec::par, *x * 2 - 1);
+    z->assign(hx::exec::seq, *x * 2 - 1);
+    assert_equal(*y, *z);
+
+    y->assign(hx::exec::par_simd, 3);
+    y->foreach(hx::exec::par, [] (int& v) { v *= 2; });
+    TS_ASSERT_EQUALS(y->min(), 6);
+    TS_ASSERT_EQUALS(y->max(), 6);
+  }
+
+  /* array.mask(policy, schedule) */
+  void testMask () {
+    using A = hx::array<int, 64, 4096>;
+    hx::schedule<3, 64, 4096> s{{ {63, 4095}, {0, 0}, {31, 7} }};
+    auto x = std::make_unique<A>();
+    x->assign(hx::exec::seq, 1);
+    x->mask(hx::exec::par, s);
+
+    TS_ASSERT_EQUALS(x->sum(), 3);
+    TS_ASSERT_EQUALS((*x)[0][0], 1);
+    TS_ASSERT_EQUALS((*x)[31][7], 1);
+    TS_ASSERT_EQUALS((*x)[63][4095], 1);
+  }
+
+  /* array.reduce(policy, ...) */
+  void testReduce () {
+    using A = hx::array<long, 1 << 20>;
+    auto x = std::make_unique<A>();
+    long k = 0;
+    x->foreach([&k] (long& v) { v = k++; });
+
+    const long n = 1 << 20;
+    TS_ASSERT_EQUALS(x->sum(), n * (n - 1) / 2);
+    TS_ASSERT_EQUALS(x->sum(hx::exec::par), n * (n - 1) / 2);
+    TS_ASSERT_EQUALS(x->sum(hx::exec::par_simd), n * (n - 1) / 2);
+    TS_ASSERT_EQUALS(x->max(hx::exec::par), n - 1);
+    TS_ASSERT_EQUALS(hx::sum(*x - 1, hx::exec::par), n * (n - 3) / 2);
+  }
+
+  /* array.sum<dim>(policy) */
+  void testProject () {
+    using A = hx::array<long, 64, 128, 32>;
+    auto x = std::make_unique<A>();
+    long k = 0;
+    x->foreach([&k] (long& v) { v = k++ % 1001; });
+
+    for (std::size_t threads : {1, 3}) {
+      hx::exec::configure(threads);
+      auto s0 = x->sum<0>(), p0 = x->sum<0>(hx::exec::par);
+      auto s2 = x->sum<2>(), p2 = x->sum<2>(hx::exec::par);
+      assert_equal(*s0, *p0);
+      assert_equal(*s2, *p2);
+      TS_ASSERT_EQUALS(s0->sum(), x->sum());
+      TS_ASSERT_EQUALS(s2->sum(), x->sum());
+    }
+  }
+
+  /* sum(policy) is reproducible across policies and thread counts. */
+  void testDeterministic () {
+    using A = hx::array<double, 1 << 16>;
+    auto x = std::make_unique<A>();
+    std::size_t k = 0;
+    x->foreach([&k] (double& v) {
+      v = std::ldexp(double(k * 7919 % 1000) - 500.5, int(k % 61) - 30);
+      k++;
+    });
+
+    const double ref = x->sum();
+    const double cref = hx::sum(*x * 2.0, hx::exec::seq, hx::exec::neumaier);
+    for (std::size_t threads : {1, 3, 4}) {
+      hx::exec::configure(threads);
+      TS_ASSERT_EQUALS(x->sum(hx::exec::par), ref);
+      TS_ASSERT_EQUALS(x->sum(hx::exec::par_simd), ref);
+      TS_ASSERT_EQUALS(hx::sum(*x * 2.0, hx::exec::par, hx::exec::neumaier),
+                       cref);
+    }
+  }
+
+  /* sum(policy, compensation) */
+  void testCompensated () {
+    using A = hx::array<double, 4096>;
+    auto x = std::make_unique<A>();
+    x->foreach([] (double& v) { v = 1; });
+    (*x)[0] = 1e16;
+    (*x)[4095] = -1e16;
+
+    TS_ASSERT(x->sum() != 4094);
+    TS_ASSERT_EQUALS(x->sum(hx::exec::par, hx::exec::neumaier), 4094);
+
+    (*x)[4095] = 0;
+    TS_ASSERT(x->sum() != 1e16 + 4094);
+    TS_ASSERT_EQUALS(x->sum(hx::exec::seq, hx::exec::kahan), 1e16 + 4094);
+  }
+
+private:
+  /* assert_equal()
+   *
+   * Check that the data of two arrays are equal.
+   */
+  template<typename T, std::size_t... Ds>
+  static void assert_equal (const hx::array<T, Ds...>& a,
+                            const hx::array<T, Ds...>& b) {
+    bool same = true;
+    typename hx::array<T, Ds...>::index_type idx;
+    do { same = same && (a[idx] == b[idx]); }
+    while (idx++);
+
+    TS_ASSERT(same);
+  }
+};
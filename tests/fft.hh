@@ -288,6 +288,65 @@ private:
   }
 };
 
+/* Test suite for hx::fft::plan
+ */
+class Plan : public CxxTest::TestSuite {
+public:
+  /* check the decomposition of a mixed-radix plan. */
+  void testStages () {
+    constexpr hx::fft::plan p{1200};
+    static_assert(p.valid() && p.stages() == 7);
+    static_assert(p.radix(0) == 5 && p.radix(6) == 2);
+    static_assert(p.span(0) == 1 && p.span(6) == 600);
+    static_assert(!hx::fft::plan{7}.valid());
+
+    /* the input reordering must be a permutation. */
+    std::vector<bool> hit(p.size());
+    for (std::size_t i = 0; i < p.size(); i++)
+      hit[p.reverse(i)] = true;
+
+    for (std::size_t i = 0; i < p.size(); i++)
+      TS_ASSERT(hit[i]);
+  }
+
+  void test360 () { ttest<360>(); }
+  void test1000 () { ttest<1000>(); }
+
+private:
+  /* ttest<N>()
+   *
+   * Template function for comparing transforms of size N
+   * against direct evaluation of the discrete Fourier transform.
+   */
+  template<std::size_t N>
+  static inline void ttest () {
+    hx::fft::forward<hx::scalar<1>, N> f;
+    hx::scalar<1> x[N], y[N];
+
+    for (std::size_t i = 0; i < N; i++)
+      x[i] = { double(i % 11) - 5, double(i % 4) };
+
+    for (std::size_t k = 0; k < N; k++) {
+      y[k] = {};
+      for (std::size_t n = 0; n < N; n++) {
+        const std::size_t m = 2 * ((n * k) % N);
+        y[k] += x[n] * hx::scalar<1>{ std::cos(m * hx::pi / N),
+                                     -std::sin(m * hx::pi / N) };
+      }
+    }
+
+    f(x);
+
+    double err = 0, nrm = 0;
+    for (std::size_t k = 0; k < N; k++) {
+      err += (x[k] - y[k]).squaredNorm();
+      nrm += y[k].squaredNorm();
+    }
+
+    TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, 1e-13);
+  }
+};
+
 /* Test suite for inverse transforms.
  */
 class Inverse : public CxxTest::TestSuite {
@@ -332,3 +391,464 @@ private:
   }
 };
 
+
+/* Test suite for out-of-core transforms.
+ */
+class OutOfCore : public CxxTest::TestSuite {
+public:
+  void test1d () { ttest<hx::array<hx::scalar<1>, 30>>(); }
+  void test2d () { ttest<hx::array<hx::scalar<2>, 10, 12>>(); }
+  void test3d () { ttest<hx::array<hx::scalar<3>, 6, 4, 5>>(); }
+
+private:
+  /* ttest<X>()
+   *
+   * Template function for comparing out-of-core and in-memory
+   * transforms of arrays of type X.
+   */
+  template<typename X>
+  static inline void ttest () {
+    using Type = typename X::base_type;
+    auto x = std::make_unique<X>();
+    auto y = std::make_unique<X>();
+
+    /* initialize the array data. */
+    std::size_t i = 0;
+    x->foreach([&i] (auto& z) {
+      for (std::size_t k = 0; k < 2 * sizeof(Type) / 16; k++)
+        z[k] = double((i * 7 + k * 3) % 11) - 5;
+      i++;
+    });
+
+    /* store the array in a temporary file. */
+    std::FILE* fh = std::tmpfile();
+    TS_ASSERT(fh != nullptr);
+    if (!fh)
+      return;
+
+    const int fd = fileno(fh);
+    TS_ASSERT_EQUALS(::pwrite(fd, reinterpret_cast<char*>(x.get()),
+                              sizeof(X), 0), ssize_t(sizeof(X)));
+
+    /* transform in memory. */
+    x->foreach_dim([&x] (auto dim) {
+      hx::fft::forward<Type, X::template shape<dim.value>,
+                       dim.value + 1> f;
+      x->template foreach_vector<dim.value>(f);
+    });
+
+    /* transform out of core, using several blocks of pencils. */
+    hx::fft::outofcore<X, hx::fft::fwd> g{sizeof(X) / 2};
+    TS_ASSERT(g(fd));
+
+    /* check that both results are identical. */
+    TS_ASSERT_EQUALS(::pread(fd, reinterpret_cast<char*>(y.get()),
+                             sizeof(X), 0), ssize_t(sizeof(X)));
+    std::fclose(fh);
+
+    typename X::index_type idx;
+    do { TS_ASSERT_EQUALS((*x)[idx], (*y)[idx]); }
+    while (idx++);
+  }
+};
+
+/* Test suite for mixed-precision transforms.
+ */
+class Mixed : public CxxTest::TestSuite {
+public:
+  void test30 () { ttest<30>(); }
+  void test128 () { ttest<128>(); }
+  void test1000 () { ttest<1000>(); }
+  void test2048 () { ttest<2048>(); }
+
+private:
+  /* ttest<N>()
+   *
+   * Template function for comparing single-precision storage
+   * transforms of size N against double-precision transforms.
+   */
+  template<std::size_t N>
+  static inline void ttest () {
+    /* declare the transforms and data arrays. */
+    hx::fft::forward<hx::scalar<2>, N, 2> f;
+    hx::fft::forward<hx::scalarf<2>, N, 2> g;
+    hx::fft::inverse<hx::scalarf<2>, N, 2> h;
+    auto x = std::make_unique<hx::scalar<2>[]>(N);
+    auto y = std::make_unique<hx::scalarf<2>[]>(N);
+    auto z = std::make_unique<hx::scalarf<2>[]>(N);
+
+    /* initialize the data arrays. */
+    for (std::size_t i = 0; i < N; i++) {
+      x[i] = { double(i % 7) - 3, 0.5, double(i % 5), -1 };
+      y[i] = z[i] = x[i];
+    }
+
+    /* errors should grow with the number of rounded passes. */
+    const double eps = std::log2(N) * std::numeric_limits<float>::epsilon();
+
+    /* compare the forward transforms. */
+    double err = 0, nrm = 0;
+    f(x.get());
+    g(y.get());
+    for (std::size_t i = 0; i < N; i++) {
+      err += (x[i] - hx::scalar<2>(y[i])).squaredNorm();
+      nrm += x[i].squaredNorm();
+    }
+    TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, eps);
+
+    /* check the round trip against the stored input. */
+    err = nrm = 0;
+    h(y.get());
+    for (std::size_t i = 0; i < N; i++) {
+      const hx::scalar<2> a = z[i], b = y[i];
+      err += (a - b / N).squaredNorm();
+      nrm += a.squaredNorm();
+    }
+    TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, eps);
+  }
+};
+
+/* Test suite for hx::fft::hilbert
+ */
+class Hilbert : public CxxTest::TestSuite {
+public:
+  void test15 () { ttest<15>(); }
+  void test16 () { ttest<16>(); }
+  void test30 () { ttest<30>(); }
+  void test128 () { ttest<128>(); }
+
+  /* regenerate the imaginaries of a real array using a node. */
+  void testNode () {
+    using X = hx::array<hx::scalar<1>, 24>;
+    auto x = std::make_unique<X>();
+
+    /* build a causal signal and transform it. */
+    for (std::size_t i = 0; i < 12; i++)
+      (*x)[i] = { (i == 0 ? 1.0 : 1.0 / i), (i == 0 ? 0.0 : i % 3 + 1.0) };
+
+    x->foreach_vector<0>(hx::fft::forward<hx::scalar<1>, 24, 1>{});
+
+    /* discard and regenerate the imaginary coefficients. */
+    auto y = hx::proc::node(x).real().hilbert()(x);
+
+    double err = 0;
+    for (std::size_t i = 0; i < 24; i++)
+      err += ((*x)[i] - (*y)[i]).squaredNorm();
+
+    TS_ASSERT_DELTA(err, 0, 1e-20);
+  }
+
+private:
+  /* ttest<N>()
+   *
+   * Template function for checking that Hilbert transforms of size N
+   * reproduce the spectra of causal signals from their real parts.
+   */
+  template<std::size_t N>
+  static inline void ttest () {
+    /* declare the transforms and data arrays. */
+    hx::fft::forward<hx::scalar<2>, N, 2> f;
+    hx::fft::hilbert<hx::scalar<2>, N, 2> h;
+    hx::scalar<2> x[N], y[N];
+
+    /* initialize a signal that is causal along unit 2. */
+    for (std::size_t i = 0; i < N; i++)
+      x[i] = (2 * i >= N ? hx::scalar<2>{}
+                         : hx::scalar<2>{ double(i % 5) - 2, 0.5,
+                                          (i ? double(i % 3) : 0.0),
+                                          (i ? -1.0 : 0.0) });
+
+    /* transform the signal, then regenerate the spectrum after
+     * scrambling its unit-2 imaginary coefficients.
+     */
+    f(x);
+    for (std::size_t i = 0; i < N; i++) {
+      y[i] = x[i];
+      y[i][2] = y[i][3] = double(i);
+    }
+
+    h(y);
+    assert_error(x, y);
+  }
+};
+
+/* Test suite for transposed transforms along array dimensions.
+ */
+class Transposed : public CxxTest::TestSuite {
+public:
+  void test2d () { ttest<hx::array<hx::scalar<2>, 30, 48>, 0>(); }
+  void test3d0 () { ttest<hx::array<hx::scalar<3>, 12, 10, 9>, 0>(); }
+  void test3d1 () { ttest<hx::array<hx::scalar<3>, 12, 10, 9>, 1>(); }
+  void test3d2 () { ttest<hx::array<hx::scalar<3>, 12, 10, 9>, 2>(); }
+
+  /* large strides select the transposed strategy. */
+  void testChoose () {
+    using X = hx::array<hx::scalar<2>, 256, 256, 256>;
+    TS_ASSERT_EQUALS((hx::proc::fft<X, 0>::mode), hx::fft::transposed);
+    TS_ASSERT_EQUALS((hx::proc::fft<X, 2>::mode), hx::fft::strided);
+  }
+
+private:
+  /* ttest<X, d>()
+   *
+   * Template function for checking that transposed transforms along
+   * dimension d of arrays X match strided transforms.
+   */
+  template<typename X, std::size_t d>
+  static inline void ttest () {
+    auto x = std::make_unique<X>();
+    typename X::index_type idx;
+    std::size_t i = 0;
+    do {
+      for (std::size_t k = 0; k < (1 << (X::ndims)); k++)
+        (*x)[idx][k] = double((i * 7 + k) % 13) - 6;
+
+      i++;
+    }
+    while (idx++);
+
+    auto y = hx::proc::node(x).template fft<d, hx::fft::strided>()(x);
+    auto z = hx::proc::node(x).template fft<d, hx::fft::transposed>()(x);
+
+    bool same = true;
+    do {
+      same = same && ((*y)[idx] == (*z)[idx]);
+    }
+    while (idx++);
+
+    TS_ASSERT(same);
+  }
+};
+
+/* Test suite for hx::fft::multi
+ */
+class Multi : public CxxTest::TestSuite {
+public:
+  void test2d () { ttest<hx::array<hx::scalar<2>, 16, 32>, 0, 1>(); }
+  void test3d () { ttest<hx::array<hx::scalar<3>, 8, 4, 16>, 0, 1, 2>(); }
+  void test3dOuter () { ttest<hx::array<hx::scalar<3>, 8, 6, 4>, 0, 2>(); }
+  void test3dInner () { ttest<hx::array<hx::scalar<3>, 5, 8, 2>, 1, 2>(); }
+  void testFallback () { ttest<hx::array<hx::scalar<2>, 6, 8>, 0, 1>(); }
+
+private:
+  /* ttest<X, Ds...>()
+   *
+   * Template function for checking that simultaneous transforms along
+   * dimensions Ds... of arrays X match successive transforms.
+   */
+  template<typename X, std::size_t... Ds>
+  static inline void ttest () {
+    using T = typename X::base_type;
+    auto x = std::make_unique<X>();
+    auto y = std::make_unique<X>();
+
+    typename X::index_type idx;
+    std::size_t i = 0;
+    do {
+      for (std::size_t k = 0; k < (1 << (X::ndims)); k++)
+        (*x)[idx][k] = double((i * 5 + k * 3) % 17) - 8;
+
+      i++;
+    }
+    while (idx++);
+
+    /* compute the reference by successive transforms. */
+    *y = *x;
+    (y->template foreach_vector<Ds>(
+       hx::fft::forward<T, X::template shape<Ds>, Ds + 1>{}), ...);
+
+    /* compute the simultaneous transform using a node. */
+    auto z = hx::proc::node(x).template fftn<Ds...>()(x);
+
+    double err = 0, nrm = 0;
+    do {
+      err += ((*y)[idx] - (*z)[idx]).squaredNorm();
+      nrm += (*y)[idx].squaredNorm();
+    }
+    while (idx++);
+
+    TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, 1e-14);
+
+    /* check the round trip of the inverse transform. */
+    if constexpr (hx::proc::fftn<X, Ds...>::pow2) {
+      const hx::fft::multi<X, hx::fft::inv, Ds...> g;
+      g(*z);
+
+      const double scale = (X::template shape<Ds> * ...);
+      err = nrm = 0;
+      do {
+        err += ((*x)[idx] - (*z)[idx] / scale).squaredNorm();
+        nrm += (*x)[idx].squaredNorm();
+      }
+      while (idx++);
+
+      TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, 1e-14);
+    }
+  }
+};
+
+/* Test suite for short-time and sliding transforms.
+ */
+class ShortTime : public CxxTest::TestSuite {
+public:
+  /* frames of an stft match windowed forward transforms. */
+  void testStft () {
+    using T = hx::scalar<1>;
+    constexpr std::size_t N = 16, Hop = 6, L = 100;
+    hx::array<T, L> x;
+    hx::array<double, N> w;
+
+    for (std::size_t i = 0; i < L; i++)
+      x[i] = T{ double(i % 9) - 4, double(i % 4) };
+
+    for (std::size_t n = 0; n < N; n++)
+      w[n] = 0.5 - 0.5 * std::cos(2 * hx::pi * n / N);
+
+    const hx::fft::stft<T, N, Hop> st{w};
+    auto y = st(x);
+    TS_ASSERT_EQUALS(y->shape<0>, 15);
+
+    const hx::fft::forward<T, N> f;
+    double err = 0;
+    for (std::size_t i = 0; i < y->shape<0>; i++) {
+      T z[N];
+      for (std::size_t n = 0; n < N; n++)
+        z[n] = x[i * Hop + n] * w[n];
+
+      f(z);
+      for (std::size_t n = 0; n < N; n++)
+        err += ((*y)[i][n] - z[n]).squaredNorm();
+    }
+
+    TS_ASSERT_DELTA(err, 0, 1e-20);
+  }
+
+  /* sliding bins match the transform of the latest window. */
+  void testSdft () {
+    using T = hx::scalar<2>;
+    constexpr std::size_t N = 30, L = 107;
+    hx::fft::sdft<T, N, 2> sd{{0, 1, 7, 29}};
+    T x[L];
+
+    for (std::size_t i = 0; i < L; i++) {
+      x[i] = T{ double(i % 5), 1, double(i % 3) - 1, 0.25 };
+      sd.push(x[i]);
+    }
+
+    T z[N];
+    for (std::size_t n = 0; n < N; n++)
+      z[n] = x[L - N + n];
+
+    hx::fft::forward<T, N, 2>{}(z);
+
+    double err = 0;
+    for (std::size_t i = 0; i < sd.size(); i++)
+      err += (sd[i] - z[sd.bin(i)]).squaredNorm();
+
+    TS_ASSERT_DELTA(err, 0, 1e-20);
+  }
+};
+
+/* Test suite for hx::fft::sparse
+ */
+class Sparse : public CxxTest::TestSuite {
+public:
+  /* integer coordinates reproduce the full transform. */
+  void testGrid () {
+    using X = hx::array<hx::scalar<3>, 6, 8, 5>;
+    auto x = std::make_unique<X>();
+    auto y = std::make_unique<X>();
+
+    X::index_type idx;
+    std::size_t i = 0;
+    do {
+      (*x)[idx] = hx::scalar<3>{ double(i % 7), 1, 0, double(i % 3),
+                                 -1, 0, 0.5, double(i % 2) };
+      i++;
+    }
+    while (idx++);
+
+    *y = *x;
+    y->foreach_dim([&y] (auto dim) {
+      constexpr std::size_t d = dim.value;
+      y->foreach_vector<d>(hx::fft::forward<hx::scalar<3>,
+                                            X::shape<d>, d + 1>{});
+    });
+
+    std::vector<hx::fft::sparse<X>::point> pts;
+    std::vector<std::array<std::size_t, 3>> ids;
+    for (std::size_t a = 0; a < 6; a += 2)
+      for (std::size_t b = 1; b < 8; b += 3)
+        for (std::size_t c = 0; c < 5; c++) {
+          pts.push_back({ double(a), double(b), double(c) });
+          ids.push_back({ a, b, c });
+        }
+
+    const hx::fft::sparse<X> sp{3};
+    const auto z = sp(*x, pts);
+
+    double err = 0, nrm = 0;
+    for (std::size_t k = 0; k < pts.size(); k++) {
+      const auto& v = (*y)[ids[k][0]][ids[k][1]][ids[k][2]];
+      err += (z[k] - v).squaredNorm();
+      nrm += v.squaredNorm();
+    }
+
+    TS_ASSERT_DELTA(std::sqrt(err / nrm), 0, 1e-13);
+  }
+
+  /* fractional coordinates match the direct Fourier sum. */
+  void testFractional () {
+    using T = hx::scalar<2>;
+    using X = hx::array<T, 7, 9>;
+    auto x = std::make_unique<X>();
+
+    for (std::size_t a = 0; a < 7; a++)
+      for (std::size_t b = 0; b < 9; b++)
+        (*x)[a][b] = T{ double(a) - 3, 0.5, double(b % 4), 1 };
+
+    const hx::fft::sparse<X> sp{2};
+    const hx::fft::sparse<X>::point p = { 1.25, 4.5 };
+    const T z = sp(*x, {p})[0];
+
+    T ref;
+    for (std::size_t a = 0; a < 7; a++)
+      for (std::size_t b = 0; b < 9; b++) {
+        const double ta = -2 * hx::pi * p[0] * a / 7;
+        const double tb = -2 * hx::pi * p[1] * b / 9;
+        const T wa = T::R() * std::cos(ta) + hx::I<1> * std::sin(ta);
+        const T wb = T::R() * std::cos(tb) + T::I() * std::sin(tb);
+        ref += (*x)[a][b] * wa * wb;
+      }
+
+    TS_ASSERT_DELTA((z - ref).norm(), 0, 1e-12);
+  }
+
+  /* unsorted and repeated points of a one-dimensional array. */
+  void testRepeated () {
+    using T = hx::scalar<1>;
+    using X = hx::array<T, 16>;
+    auto x = std::make_unique<X>();
+    for (std::size_t i = 0; i < 16; i++)
+      (*x)[i] = T{ double(i % 5), double(i % 3) };
+
+    const X& cx = *x;
+    const hx::fft::sparse<X> sp{4};
+    const std::vector<hx::fft::sparse<X>::point> pts =
+      {{ 3.5 }, { 0 }, { 3.5 }, { -2 }, { 0 }};
+    const auto z = sp(cx, pts);
+
+    for (std::size_t k = 0; k < pts.size(); k++) {
+      T ref;
+      for (std::size_t i = 0; i < 16; i++) {
+        const double t = -2 * hx::pi * pts[k][0] * i / 16;
+        ref += (*x)[i] * (T::R() * std::cos(t) + T::I() * std::sin(t));
+      }
+
+      TS_ASSERT_DELTA((z[k] - ref).norm(), 0, 1e-12);
+    }
+
+    TS_ASSERT_EQUALS(z[0], z[2]);
+    TS_ASSERT_EQUALS(z[1], z[4]);
+  }
+};
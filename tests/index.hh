@@ -276,6 +276,23 @@ public:
     TS_ASSERT_EQUALS(Idx::stride<3>, 1);
   }
 
+  /* pack_tiled(), unpack_tiled() */
+  void testTiled () {
+    hx::index<6, 4, 2> idx, chk;
+    std::size_t offset = 0;
+    do {
+      chk.unpack_tiled<2>(idx.pack_tiled<2>());
+      assert_values(chk, idx);
+      offset = std::max(offset, idx.pack_tiled<2>());
+    }
+    while (idx++);
+
+    TS_ASSERT_EQUALS(offset, 47);
+    TS_ASSERT_EQUALS((hx::index<6, 4, 2>{0, 1, 0}.pack_tiled<2>()), 2);
+    TS_ASSERT_EQUALS((hx::index<6, 4, 2>{0, 2, 0}.pack_tiled<2>()), 8);
+    TS_ASSERT_EQUALS((hx::index<6, 4, 2>{2, 0, 0}.pack_tiled<2>()), 16);
+  }
+
 private:
   /* assert_values()
    *
@@ -0,0 +1,66 @@
+
+#include "../hx/core.hh"
+#include <cxxtest/TestSuite.h>
+
+class Cursor : public CxxTest::TestSuite {
+public:
+  /* cursor++ */
+  void testIncrement () {
+    hx::cursor<3, 4, 5> cur;
+    hx::index<3, 4, 5> idx;
+    std::size_t n = 0;
+    do {
+      TS_ASSERT(cur.index() == idx);
+      TS_ASSERT_EQUALS(cur.offset(), n);
+      TS_ASSERT_EQUALS(cur.offset(), idx.pack_right());
+      idx++;
+      n++;
+    }
+    while (cur++);
+
+    TS_ASSERT_EQUALS(n, 60);
+    TS_ASSERT_EQUALS(cur.offset(), 0);
+    TS_ASSERT_EQUALS(cur[2], 0);
+  }
+
+  /* cursor(offset), cursor += dim */
+  void testSkip () {
+    hx::cursor<3, 4, 5> cur(27);
+    TS_ASSERT_EQUALS(cur[0], 1);
+    TS_ASSERT_EQUALS(cur[1], 1);
+    TS_ASSERT_EQUALS(cur[2], 2);
+    TS_ASSERT_EQUALS((hx::cursor<3, 4, 5>::stride(0)), 20);
+
+    hx::cursor<3, 4, 5> c;
+    hx::index<3, 4, 5> idx;
+    std::size_t n = 1;
+    while (c += hx::dim<1>{}) {
+      idx += hx::dim<1>{};
+      TS_ASSERT(c.index() == idx);
+      TS_ASSERT_EQUALS(c.offset(), idx.pack_right());
+      n++;
+    }
+
+    TS_ASSERT_EQUALS(n, 15);
+    TS_ASSERT_EQUALS(c.offset(), 0);
+  }
+
+  /* array[cursor] */
+  void testSubscript () {
+    hx::array<int, 3, 4> x;
+    hx::array<int, 4> y;
+    hx::cursor<3, 4> cur;
+    int k = 0;
+    do {
+      x[cur] = k++;
+    }
+    while (cur++);
+
+    TS_ASSERT_EQUALS(x[2][1], 9);
+    TS_ASSERT_EQUALS((x[hx::cursor<3, 4>(7)]), 7);
+
+    y = 1;
+    y[hx::cursor<4>(2)] = 5;
+    TS_ASSERT_EQUALS(y.sum(), 8);
+  }
+};
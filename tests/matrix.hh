@@ -46,6 +46,29 @@ public:
     TS_ASSERT_EQUALS(x[0][2][2], -500022);
   }
 
+  /* matrix op= value, matrix op= matrix */
+  void testCompoundAssignment () {
+    hx::array<int, 2, 2> A{{1, 2, 3, 4}}, B{{4, 3, 2, 1}};
+    hx::matrix{A} *= 3;
+    hx::matrix{A} -= hx::matrix{B};
+    TS_ASSERT_EQUALS(A[0][0], -1);
+    TS_ASSERT_EQUALS(A[0][1], 3);
+    TS_ASSERT_EQUALS(A[1][0], 7);
+    TS_ASSERT_EQUALS(A[1][1], 11);
+  }
+
+  /* matrix += transpose(matrix) */
+  void testCompoundTranspose () {
+    hx::array<int, 2, 2> A{{1, 2, 3, 4}};
+    hx::matrix<decltype(A), 0, 1> M{A};
+    hx::matrix<decltype(A), 1, 0> T{A};
+    M += T;
+    TS_ASSERT_EQUALS(A[0][0], 2);
+    TS_ASSERT_EQUALS(A[0][1], 5);
+    TS_ASSERT_EQUALS(A[1][0], 5);
+    TS_ASSERT_EQUALS(A[1][1], 8);
+  }
+
   /* matrix = matrix * matrix */
   void testMatrixMatrixProduct () {
     hx::array<int, 2, 3> A{{1, 2, 3, 4, 5, 6}};
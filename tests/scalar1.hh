@@ -74,6 +74,20 @@ public:
     assert_values(x, {1, 1.5});
   }
 
+  /* scalar *= scalar */
+  void testScalarMultiplyAssignment () {
+    hx::scalar<1> x{1, 2};
+    x *= hx::scalar<1>{3, 4};
+    assert_values(x, {-5, 10});
+  }
+
+  /* scalar /= scalar */
+  void testScalarDivideAssignment () {
+    hx::scalar<1> x{-5, 10};
+    x /= hx::scalar<1>{3, 4};
+    assert_values(x, {1, 2});
+  }
+
   /* ~scalar */
   void testConjugation () {
     hx::scalar<1> x{2, 3};
@@ -0,0 +1,40 @@
+
+#include "scalar.hh"
+
+class ScalarF : public CxxTest::TestSuite {
+public:
+  /* scalarf{} */
+  void testDefaultConstructor () {
+    hx::scalarf<2> x;
+    for (std::size_t i = 0; i < 4; i++)
+      TS_ASSERT_EQUALS(x[i], 0);
+  }
+
+  /* scalarf{scalar} */
+  void testNarrow () {
+    hx::scalar<1> a{0.1, 2};
+    hx::scalarf<1> x{a};
+    TS_ASSERT_EQUALS(x[0], 0.1f);
+    TS_ASSERT_EQUALS(x[1], 2.0f);
+  }
+
+  /* scalar{scalarf} */
+  void testWiden () {
+    hx::scalarf<2> x;
+    x[0] = 1; x[1] = 2; x[2] = 3; x[3] = 4;
+    hx::scalar<2> a = x;
+    assert_values(a, {1, 2, 3, 4});
+  }
+
+  /* wide_type_t */
+  void testWideType () {
+    constexpr auto a = std::is_same_v<hx::wide_type_t<hx::scalarf<2>>,
+                                      hx::scalar<2>>;
+    constexpr auto b = std::is_same_v<hx::wide_type_t<hx::scalar<2>>,
+                                      hx::scalar<2>>;
+    TS_ASSERT_EQUALS(a, true);
+    TS_ASSERT_EQUALS(b, true);
+    TS_ASSERT_EQUALS(hx::is_scalarf_v<hx::scalarf<0>>, true);
+    TS_ASSERT_EQUALS(hx::is_scalarf_v<hx::scalar<0>>, false);
+  }
+};
@@ -0,0 +1,58 @@
+
+#include "scalar.hh"
+
+class Math : public CxxTest::TestSuite {
+public:
+  /* norm(), abs(), squaredNorm() */
+  void testNorm () {
+    TS_ASSERT_EQUALS(hx::norm(-3.0), 3);
+    TS_ASSERT_EQUALS(hx::abs(-3.0), 3);
+    TS_ASSERT_EQUALS(hx::squaredNorm(-3.0), 9);
+
+    hx::scalar<2> x{1, 2, 2, 4};
+    TS_ASSERT_EQUALS(hx::norm(x), 5);
+    TS_ASSERT_EQUALS(hx::abs(x), 5);
+    TS_ASSERT_EQUALS(hx::squaredNorm(x), 25);
+    TS_ASSERT_EQUALS(hx::squaredNorm(x), (x * ~x)[0]);
+  }
+
+  /* conj(scalar, unit) */
+  void testConj () {
+    hx::scalar<2> x{1, 2, 3, 4};
+    assert_values(hx::conj(x, 1), {1, -2, 3, -4});
+    assert_values(hx::conj(x, 2), {1, 2, -3, -4});
+    assert_values(hx::conj(hx::conj(x, 1), 2), ~x);
+  }
+
+  /* exp(scalar) */
+  void testExp () {
+    const hx::scalar<1> z = hx::exp(hx::scalar<1>{0, hx::pi});
+    TS_ASSERT_DELTA(z[0], -1, 1e-15);
+    TS_ASSERT_DELTA(z[1], 0, 1e-15);
+
+    const hx::scalar<2> x{0.1, -0.2, 0.3, 0.4};
+    const hx::scalar<2> y = hx::exp(x) * hx::exp(-x);
+    for (std::size_t i = 0; i < 4; i++)
+      TS_ASSERT_DELTA(y[i], i == 0 ? 1 : 0, 1e-15);
+  }
+
+  /* sqrt(scalar) */
+  void testSqrt () {
+    assert_values(hx::sqrt(hx::scalar<1>{3, 4}), {2, 1});
+    assert_values(hx::sqrt(hx::scalar<1>{-4, 0}), {0, 2});
+
+    const hx::scalar<2> x{1, -2, 3, 0.5};
+    const hx::scalar<2> y = hx::sqrt(x) * hx::sqrt(x);
+    for (std::size_t i = 0; i < 4; i++)
+      TS_ASSERT_DELTA(y[i], x[i], 1e-14);
+  }
+
+  /* soft_threshold() */
+  void testSoftThreshold () {
+    TS_ASSERT_EQUALS(hx::soft_threshold(-3.0, 1), -2);
+    TS_ASSERT_EQUALS(hx::soft_threshold(-3.0, 4), 0);
+    assert_values(hx::soft_threshold(hx::scalar<1>{3, 4}, 2.5),
+                  {1.5, 2});
+    assert_values(hx::soft_threshold(hx::scalar<1>{3, 4}, 6), {0, 0});
+  }
+};
@@ -69,6 +69,48 @@ public:
     TS_ASSERT_EQUALS(v[1], x[0][2][0]);
   }
 
+  /* vector op= value, vector op= vector */
+  void testCompoundAssignment () {
+    hx::vector<decltype(x), 0> u{x, idx};
+    hx::vector<decltype(x), 2> v{x, {1, 1, 0}};
+    u -= 500000;
+    ttest(u, [] (auto i) { return 100 * int(i); });
+    v -= 500110;
+    v *= 2;
+    ttest(v, [] (auto i) { return 2 * int(i); });
+    u += v;
+    ttest(u, [] (auto i) { return 102 * int(i); });
+  }
+
+  /* vector op= vector [overlapping] */
+  void testCompoundAliasing () {
+    hx::array<int, 3, 3> A{{1, 2, 3,
+                            4, 5, 6,
+                            7, 8, 9}};
+    hx::vector<decltype(A), 1> u{&A[0][1]};
+    hx::vector<decltype(A), 1> v{A, {0, 0}};
+    u += v;
+    TS_ASSERT_EQUALS(A[0][0], 1);
+    TS_ASSERT_EQUALS(A[0][1], 3);
+    TS_ASSERT_EQUALS(A[0][2], 5);
+    TS_ASSERT_EQUALS(A[1][0], 7);
+  }
+
+  /* vector op= vector [overlapping, long] */
+  void testCompoundAliasingLong () {
+    constexpr std::size_t len = 1 << 20;
+    auto A = std::make_unique<hx::array<double, len + 1>>();
+    for (std::size_t i = 0; i <= len; i++)
+      (*A)[i] = i;
+
+    hx::vector<hx::array<double, len + 1>, 0, len> u{&(*A)[1]};
+    hx::vector<hx::array<double, len + 1>, 0, len> v{&(*A)[0]};
+    u += v;
+    TS_ASSERT_EQUALS((*A)[0], 0);
+    TS_ASSERT_EQUALS((*A)[1], 1);
+    TS_ASSERT_EQUALS((*A)[len], 2 * len - 1);
+  }
+
   /* vector * vector */
   void testInnerProduct () {
     hx::array<int, 3, 2> A{{2, 7,
@@ -88,6 +130,14 @@ public:
     TS_ASSERT_EQUALS(hx::is_vector_v<Y>, true);
   }
 
+  /* sizeof(vector) */
+  void testFootprint () {
+    using X = hx::vector<hx::array<float, 4, 4>, 1>;
+    using Y = hx::vector<hx::tiled<float, 2, 4, 4>, 1>;
+    TS_ASSERT_EQUALS(sizeof(X), sizeof(float*));
+    TS_ASSERT_EQUALS(sizeof(Y), sizeof(float*) + sizeof(std::size_t));
+  }
+
   /* vector_len_v */
   void testLength () {
     using A = hx::array<hx::scalar<2>, 3, 3>;